@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdio>
+#include <atomic>
+#include <fstream>
+#include <string>
+
+namespace BenchHelpers {
+	// counted by the global operator new in bench_main.cpp
+	inline std::atomic<size_t> allocationCount = 0;
+
+	// runs the function a few times and keeps the fastest, so one slow run (page faults, another process) doesnt skew it
+	template<typename Function>
+	inline double bestSeconds(Function&& function, int repeats = 5) {
+		double best = 1.0e30;
+
+		for (int i = 0; i < repeats; i++) {
+			auto start = std::chrono::steady_clock::now();
+			function();
+			auto end = std::chrono::steady_clock::now();
+
+			double seconds = std::chrono::duration<double>(end - start).count();
+			if (seconds < best) {
+				best = seconds;
+			}
+		}
+
+		return best;
+	}
+
+	inline void report(const char* name, double seconds, size_t bytes, size_t items, const char* itemName) {
+		std::printf("%-40s %10.3f ms %10.1f MB/s %10.2f ns/%s\n", name, seconds * 1.0e3, bytes / seconds / 1.0e6, seconds * 1.0e9 / items, itemName);
+	}
+
+	// peak resident memory since the last resetPeakMemory, in bytes
+	// linux only, everywhere else this is always 0
+	inline size_t peakMemoryBytes() {
+#ifdef __linux__
+		std::ifstream status("/proc/self/status");
+		std::string line;
+		while (std::getline(status, line)) {
+			if (line.rfind("VmHWM:", 0) == 0) {
+				return std::stoull(line.substr(6)) * 1024;
+			}
+		}
+#endif
+		return 0;
+	}
+
+	// drops the peak back down to what is resident right now (linux 4.0 and newer)
+	inline void resetPeakMemory() {
+#ifdef __linux__
+		std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+	}
+};
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <string>
+#include <vector>
+
+namespace AttributeMaskBenchmark {
+	// what a tool that only wants the bounds does, through the event parser so nothing is stored
+	struct BoundsHandler {
+		glm::vec3 lowest = glm::vec3(1.0e30f);
+		glm::vec3 highest = glm::vec3(-1.0e30f);
+
+		objParser::Error onObject(std::string_view) { return objParser::ErrorType::OK; }
+		objParser::Error onVertex(float x, float y, float z, float w) {
+			glm::vec3 position(x / w, y / w, z / w);
+			lowest = glm::min(lowest, position);
+			highest = glm::max(highest, position);
+			return objParser::ErrorType::OK;
+		}
+		objParser::Error onNormal(float, float, float) { return objParser::ErrorType::OK; }
+		objParser::Error onTexCoord(float, float, float) { return objParser::ErrorType::OK; }
+		objParser::Error onFace(const objParser::FaceCorners&) { return objParser::ErrorType::OK; }
+		objParser::Error onUseMtl(std::string_view) { return objParser::ErrorType::OK; }
+		objParser::Error onMtlLib(std::string_view) { return objParser::ErrorType::OK; }
+	};
+
+	inline void run() {
+		constexpr size_t vertexCount = 2000000;
+		std::string contents = ReserveBenchmark::makeFullMeshObj(vertexCount);
+
+		struct Mask {
+			const char* name;
+			objParser::Attributes attributes;
+		};
+		const Mask masks[] = {
+			{ "mask all", objParser::Attributes::all },
+			{ "mask positions | faces", objParser::Attributes::positions | objParser::Attributes::faces },
+			{ "mask positions", objParser::Attributes::positions }
+		};
+
+		for (const Mask& mask : masks) {
+			objParser::ParseOptions options;
+			options.attributes = mask.attributes;
+
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				std::vector<objParser::Mesh> meshs;
+				std::vector<objParser::Material> materials;
+				objParser::parseObjBuffer(contents, "", meshs, materials, options);
+			}, 3);
+
+			BenchHelpers::report(mask.name, seconds, contents.size(), vertexCount, "vertex");
+		}
+
+		BoundsHandler bounds;
+		double seconds = BenchHelpers::bestSeconds([&]() {
+			bounds = BoundsHandler();
+			objParser::parseObj(contents, bounds);
+		}, 3);
+		BenchHelpers::report("bounds, every line read", seconds, contents.size(), vertexCount, "vertex");
+
+		seconds = BenchHelpers::bestSeconds([&]() {
+			bounds = BoundsHandler();
+			objParser::parseObj<objParser::Attributes::positions>(contents, bounds);
+		}, 3);
+		BenchHelpers::report("bounds, positions only", seconds, contents.size(), vertexCount, "vertex");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <string>
+#include <vector>
+
+namespace FaceParseBenchmark {
+	enum FaceFormat {
+		v,
+		vvt,
+		vvn,
+		vvtvn
+	};
+
+	inline void appendFaceElement(std::string& contents, FaceFormat format, int index) {
+		std::string number = std::to_string(index);
+
+		contents += ' ';
+		contents += number;
+
+		switch (format) {
+		case FaceFormat::vvt:
+			contents += '/' + number;
+			break;
+		case FaceFormat::vvn:
+			contents += "//" + number;
+			break;
+		case FaceFormat::vvtvn:
+			contents += '/' + number + '/' + number;
+			break;
+		default:
+			break;
+		}
+	}
+
+	// a few verts followed by nothing but faces, so the time is almost all face parsing
+	inline std::string makeFaceHeavyObj(size_t faceCount, FaceFormat format) {
+		std::string contents = "o bench\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 0 1\nvn 0 0 1\nvn 0 1 0\nvn 1 0 0\n";
+
+		for (size_t i = 0; i < faceCount; i++) {
+			contents += 'f';
+			appendFaceElement(contents, format, static_cast<int>(i % 3) + 1);
+			appendFaceElement(contents, format, static_cast<int>((i + 1) % 3) + 1);
+			appendFaceElement(contents, format, -static_cast<int>((i + 2) % 3) - 1);
+			contents += '\n';
+		}
+
+		return contents;
+	}
+
+	inline void run() {
+		constexpr size_t faceCount = 1000000;
+
+		const std::pair<const char*, FaceFormat> formats[] = {
+			{ "faces v", FaceFormat::v },
+			{ "faces v/vt", FaceFormat::vvt },
+			{ "faces v//vn", FaceFormat::vvn },
+			{ "faces v/vt/vn", FaceFormat::vvtvn },
+		};
+
+		for (const auto& [name, format] : formats) {
+			std::string contents = makeFaceHeavyObj(faceCount, format);
+
+			size_t allocations = 0;
+			objParser::ScratchStatistics scratchStatistics;
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				std::vector<objParser::Mesh> meshs;
+				std::vector<objParser::Material> materials;
+
+				objParser::ParseOptions options;
+				options.scratchStatistics = &scratchStatistics;
+
+				size_t allocationsBefore = BenchHelpers::allocationCount;
+				objParser::parseObjBuffer(contents, "", meshs, materials, options);
+				allocations = BenchHelpers::allocationCount - allocationsBefore;
+			});
+
+			BenchHelpers::report(name, seconds, contents.size(), faceCount, "face");
+
+			// whats left is the output vectors growing, which is a handful of allocations for the whole file
+			std::printf("%-40s %10zu allocations for %zu faces, %zu of them scratch\n", "", allocations, faceCount, scratchStatistics.heapAllocations);
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#include <string>
+#include <vector>
+#include <thread>
+
+namespace ParallelParseBenchmark {
+	// one big mesh like a photogrammetry scan, so every chunk carries on the mesh from the one before
+	inline std::string makeScanLikeObj(size_t vertexCount) {
+		std::string contents = "o scan\n";
+
+		char line[96];
+		for (size_t i = 0; i < vertexCount; i++) {
+			int length = std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\n", i * 0.001, i * -0.002, i * 0.003, (i % 1000) * 0.001, (i % 997) * 0.001);
+			contents.append(line, length);
+
+			if (i >= 2) {
+				length = std::snprintf(line, sizeof(line), "f -3/-3 -2/-2 -1/-1\n");
+				contents.append(line, length);
+			}
+		}
+
+		return contents;
+	}
+
+	inline void run() {
+		std::string contents = makeScanLikeObj(1000000);
+
+		unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		for (unsigned threads : { 1u, 2u, 4u, hardwareThreads }) {
+			objParser::ParseOptions options;
+			options.threadCount = threads;
+
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				std::vector<objParser::Mesh> meshs;
+				std::vector<objParser::Material> materials;
+				objParser::parseObjBuffer(contents, "", meshs, materials, options);
+			});
+
+			std::string name = "parallel parse " + std::to_string(threads) + " threads";
+			BenchHelpers::report(name.c_str(), seconds, contents.size(), 1000000, "vertex");
+		}
+	}
+}
\ No newline at end of file
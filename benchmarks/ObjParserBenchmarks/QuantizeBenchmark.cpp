@@ -0,0 +1,55 @@
+#include <random>
+#include <vector>
+
+namespace QuantizeBenchmark {
+	inline objParser::Mesh makeMesh(size_t count) {
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+		objParser::Mesh mesh("bench");
+		mesh.vertices.reserve(count);
+		mesh.vertexTextureCoordinates.reserve(count);
+		mesh.vertexNormals.reserve(count);
+
+		for (size_t i = 0; i < count; i++) {
+			mesh.vertices.emplace_back(value(rng) * 100.0f, value(rng) * 100.0f, value(rng) * 100.0f);
+			mesh.vertexTextureCoordinates.emplace_back(value(rng), value(rng), 0.0f);
+			mesh.vertexNormals.emplace_back(value(rng), value(rng), value(rng));
+		}
+
+		return mesh;
+	}
+
+	// the whole thing, including measuring the error, at each instruction set
+	inline void run() {
+		constexpr size_t count = 2000000;
+		objParser::Mesh mesh = makeMesh(count);
+		size_t inputBytes = count * 3 * sizeof(glm::vec3);
+
+		objParser::SimdLevel detected = objParser::detectedSimdLevel();
+		const objParser::SimdLevel levels[] = { objParser::SimdLevel::scalar, objParser::SimdLevel::sse2, objParser::SimdLevel::avx2 };
+
+		for (objParser::SimdLevel level : levels) {
+			if (level > detected) {
+				continue;
+			}
+			objParser::setSimdLevel(level);
+
+			std::ostringstream name;
+			name << "quantize " << level;
+
+			objParser::QuantizedMesh quantizedMesh;
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				objParser::quantizeMesh(mesh, quantizedMesh);
+			});
+			BenchHelpers::report(name.str().c_str(), seconds, inputBytes, count, "vertex");
+
+			if (level == objParser::SimdLevel::scalar) {
+				size_t outputBytes = (quantizedMesh.positions.size() + quantizedMesh.textureCoordinates.size() + quantizedMesh.normals.size()) * sizeof(uint16_t);
+				std::printf("%-40s %10zu bytes -> %zu bytes, max error %g / %g / %g rad\n", "quantized size", inputBytes, outputBytes, quantizedMesh.maxPositionError, quantizedMesh.maxTextureCoordinateError, quantizedMesh.maxNormalError);
+			}
+		}
+
+		objParser::setSimdLevel(detected);
+	}
+}
\ No newline at end of file
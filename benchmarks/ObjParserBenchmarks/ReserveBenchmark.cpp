@@ -0,0 +1,57 @@
+#include <string>
+#include <vector>
+
+namespace ReserveBenchmark {
+	// one mesh with every attribute, the worst case for vectors growing one element at a time
+	inline std::string makeFullMeshObj(size_t vertexCount) {
+		std::string contents = "o bench\n";
+
+		char line[160];
+		for (size_t i = 0; i < vertexCount; i++) {
+			int length = std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0 0 1\n", i * 0.001, i * -0.002, i * 0.003, (i % 1000) * 0.001, (i % 997) * 0.001);
+			contents.append(line, length);
+
+			if (i >= 2) {
+				length = std::snprintf(line, sizeof(line), "f -3/-3/-3 -2/-2/-2 -1/-1/-1\n");
+				contents.append(line, length);
+			}
+		}
+
+		return contents;
+	}
+
+	inline void run() {
+		constexpr size_t vertexCount = 2000000;
+		std::string contents = makeFullMeshObj(vertexCount);
+
+		for (bool reserveExact : { false, true }) {
+			objParser::ParseOptions options;
+			options.reserveExact = reserveExact;
+
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				std::vector<objParser::Mesh> meshs;
+				std::vector<objParser::Material> materials;
+				objParser::parseObjBuffer(contents, "", meshs, materials, options);
+			}, 3);
+
+			// only the memory the parse itself adds on top of the file
+			BenchHelpers::resetPeakMemory();
+			size_t before = BenchHelpers::peakMemoryBytes();
+
+			size_t resultBytes = 0;
+			{
+				std::vector<objParser::Mesh> meshs;
+				std::vector<objParser::Material> materials;
+				objParser::parseObjBuffer(contents, "", meshs, materials, options);
+
+				const objParser::Mesh& mesh = meshs.front();
+				resultBytes = (mesh.vertices.size() + mesh.vertexTextureCoordinates.size() + mesh.vertexNormals.size()) * sizeof(glm::vec3)
+					+ (mesh.vertexIndexes.size() + mesh.vertexTextureCoordinatesIndexes.size() + mesh.vertexNormalsIndexes.size()) * sizeof(int);
+			}
+			size_t peak = BenchHelpers::peakMemoryBytes() - before;
+
+			BenchHelpers::report(reserveExact ? "reserve exact" : "reserve by growing", seconds, contents.size(), vertexCount, "vertex");
+			std::printf("%48.1f MB peak for %.1f MB of mesh\n", peak / 1.0e6, resultBytes / 1.0e6);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include <string>
+
+namespace ScanBenchmark {
+	// looks like a real vertex heavy obj, so the newlines are as far apart as they would be
+	inline std::string makeVertexHeavyObj(size_t vertexCount) {
+		std::string contents = "o bench\n";
+
+		char line[96];
+		for (size_t i = 0; i < vertexCount; i++) {
+			int length = std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\n", i * 0.001, i * -0.002, i * 0.003);
+			contents.append(line, length);
+		}
+
+		return contents;
+	}
+
+	// just the scan stage, no parsing
+	inline void run() {
+		std::string contents = makeVertexHeavyObj(4000000);
+		const char* begin = contents.data();
+		const char* end = contents.data() + contents.size();
+
+		objParser::SimdLevel detected = objParser::detectedSimdLevel();
+		const objParser::SimdLevel levels[] = { objParser::SimdLevel::scalar, objParser::SimdLevel::sse2, objParser::SimdLevel::avx2, objParser::SimdLevel::avx512 };
+
+		for (objParser::SimdLevel level : levels) {
+			if (level > detected) {
+				continue;
+			}
+			objParser::setSimdLevel(level);
+
+			std::ostringstream name;
+			name << "scan " << level;
+
+			size_t lines = 0;
+			double seconds = BenchHelpers::bestSeconds([&]() {
+				lines = 0;
+				for (const char* it = begin; it < end; it = objParser::findNewline(it, end) + 1) {
+					lines++;
+				}
+			});
+			std::printf("%-40s %10.3f ms %10.2f GB/s %10zu lines\n", (name.str() + " findNewline").c_str(), seconds * 1.0e3, contents.size() / seconds / 1.0e9, lines);
+
+			seconds = BenchHelpers::bestSeconds([&]() {
+				lines = 0;
+				objParser::LineSplitter splitter(contents);
+				std::string_view line;
+				while (splitter.next(line)) {
+					lines++;
+				}
+			});
+			std::printf("%-40s %10.3f ms %10.2f GB/s %10zu lines\n", (name.str() + " LineSplitter").c_str(), seconds * 1.0e3, contents.size() / seconds / 1.0e9, lines);
+		}
+
+		objParser::setSimdLevel(detected);
+	}
+}
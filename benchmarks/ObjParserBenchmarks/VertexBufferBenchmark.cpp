@@ -0,0 +1,59 @@
+#include <string>
+#include <vector>
+
+namespace VertexBufferBenchmark {
+	// a grid where every inner vertex is shared by six triangles, like most real meshs
+	inline objParser::Mesh makeGridMesh(int size) {
+		objParser::Mesh mesh("grid");
+
+		for (int y = 0; y < size; y++) {
+			for (int x = 0; x < size; x++) {
+				mesh.vertices.emplace_back(x, y, 0.0f);
+				mesh.vertexTextureCoordinates.emplace_back(x / float(size), y / float(size), 0.0f);
+			}
+		}
+		mesh.vertexNormals.emplace_back(0.0f, 0.0f, 1.0f);
+
+		auto addCorner = [&mesh, size](int x, int y) {
+			mesh.vertexIndexes.push_back(y * size + x);
+			mesh.vertexTextureCoordinatesIndexes.push_back(y * size + x);
+			mesh.vertexNormalsIndexes.push_back(0);
+		};
+
+		for (int y = 0; y + 1 < size; y++) {
+			for (int x = 0; x + 1 < size; x++) {
+				addCorner(x, y);
+				addCorner(x + 1, y);
+				addCorner(x + 1, y + 1);
+				addCorner(x, y);
+				addCorner(x + 1, y + 1);
+				addCorner(x, y + 1);
+			}
+		}
+
+		return mesh;
+	}
+
+	inline void run() {
+		std::vector<objParser::Mesh> meshs;
+		for (int i = 0; i < 8; i++) {
+			meshs.push_back(makeGridMesh(500));
+		}
+
+		size_t cornerCount = meshs.size() * meshs.front().vertexIndexes.size();
+
+		objParser::VertexBuffer vertexBuffer;
+		double seconds = BenchHelpers::bestSeconds([&]() {
+			for (const objParser::Mesh& mesh : meshs) {
+				objParser::buildVertexBuffer(mesh, vertexBuffer);
+			}
+		});
+		BenchHelpers::report("weld one mesh at a time", seconds, cornerCount * 3 * sizeof(int), cornerCount, "corner");
+
+		std::vector<objParser::VertexBuffer> vertexBuffers;
+		seconds = BenchHelpers::bestSeconds([&]() {
+			objParser::buildVertexBuffers(meshs, vertexBuffers);
+		});
+		BenchHelpers::report("weld all meshs on threads", seconds, cornerCount * 3 * sizeof(int), cornerCount, "corner");
+	}
+}
\ No newline at end of file
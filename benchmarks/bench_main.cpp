@@ -0,0 +1,47 @@
+// unity build of all the benchmarks
+// numbers only mean something in an optimized build: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+
+#define OBJ_PARSER_IMPLEMENTATION
+#include "../obj_parser/obj_parser.hpp"
+#include "BenchHelpers.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#include "ObjParserBenchmarks/FaceParseBenchmark.cpp"
+#include "ObjParserBenchmarks/ParallelParseBenchmark.cpp"
+#include "ObjParserBenchmarks/QuantizeBenchmark.cpp"
+#include "ObjParserBenchmarks/ReserveBenchmark.cpp"
+#include "ObjParserBenchmarks/AttributeMaskBenchmark.cpp"
+#include "ObjParserBenchmarks/ScanBenchmark.cpp"
+#include "ObjParserBenchmarks/VertexBufferBenchmark.cpp"
+
+// count every heap allocation so the benchmarks can show where the parser allocates
+void* operator new(std::size_t size) {
+	BenchHelpers::allocationCount++;
+
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+int main() {
+	ScanBenchmark::run();
+	FaceParseBenchmark::run();
+	ParallelParseBenchmark::run();
+	ReserveBenchmark::run();
+	AttributeMaskBenchmark::run();
+	VertexBufferBenchmark::run();
+	QuantizeBenchmark::run();
+
+	return 0;
+}
@@ -0,0 +1,183 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "Mesh.hpp"
+#include "Material.hpp"
+#include "ParseOptions.hpp"
+#include "MappedFile.hpp"
+#include "ContentHash.hpp"
+#include <cstdint>
+#include <filesystem>
+
+/*
+ * A binary cache is a parse result written out as it sits in memory, so loading it is a map and a few bounds checks
+ * The file is:
+ *     BinaryCacheHeader
+ *     one BinaryCacheMeshRecord per mesh
+ *     one BinaryCacheMaterialRecord per material
+ *     one BinaryCacheDependencyRecord per file the result was made from
+ *     every array the records point to, each one 16 byte aligned
+ * Every pointer in it is an offset from the start of the file, so a mapped cache is used in place with nothing to fix up
+ * The arrays are raw memory, so a cache only loads in a build with the same OBJ_PARSER_INDEX_TYPE, size_t and byte order
+ */
+
+namespace objParser {
+	// bumped whenever the layout of the file changes, a cache from another version is a FileFormatError
+	constexpr uint32_t binaryCacheVersion = 3;
+
+	// count elements starting offset bytes into the file
+	struct BinaryCacheArray {
+		uint64_t offset;
+		uint64_t count;
+	};
+
+	struct BinaryCacheHeader {
+		char magic[8];
+		uint32_t version;
+
+		// what the writing build looked like, checked against the reading one
+		uint16_t indexSize;
+		uint16_t indexSigned;
+		uint32_t sizeSize;
+		uint32_t byteOrder;
+
+		uint64_t fileSize;
+
+		// ContentHash of everything after the header
+		uint64_t checksum;
+
+		BinaryCacheArray meshs;
+		BinaryCacheArray materials;
+		BinaryCacheArray dependencies;
+	};
+
+	struct BinaryCacheMeshRecord {
+		BinaryCacheArray vertices;
+		BinaryCacheArray vertexTextureCoordinates;
+		BinaryCacheArray vertexNormals;
+
+		// x, y, z
+		BinaryCacheArray vertexArrays[3];
+		BinaryCacheArray vertexTextureCoordinateArrays[3];
+		BinaryCacheArray vertexNormalArrays[3];
+
+		BinaryCacheArray vertexIndexes;
+		BinaryCacheArray vertexTextureCoordinatesIndexes;
+		BinaryCacheArray vertexNormalsIndexes;
+
+		BinaryCacheArray name;
+		BinaryCacheArray materialRanges;
+
+		// all bits set for objParser::noMaterial, whatever size_t is
+		uint64_t mtlIndex;
+	};
+
+	struct BinaryCacheMaterialRecord {
+		BinaryCacheArray name;
+		glm::vec3 ambientColor;
+		glm::vec3 diffuseColor;
+		glm::vec3 specularColor;
+		float specularExponent;
+		float transparent;
+		glm::vec3 transmissionFilter;
+		float indexOfRefraction;
+		float padding;
+	};
+
+	struct BinaryCacheDependencyRecord {
+		BinaryCacheArray path;
+		BinaryCacheArray listedPath;
+		uint64_t hash;
+	};
+
+	// a file a cached result depends on (the mtl files of an obj for example), and the ContentHash it had
+	// the paths are utf-8, what std::filesystem::path::u8string gives
+	struct CacheDependency {
+		// where the file is, absolute, what the hash is checked against
+		std::string path;
+		uint64_t hash;
+
+		// the path as the parse wrote it out (ParseOptions::materialLibraries), so a cached result can give back the same one
+		std::string listedPath;
+	};
+
+	// a mesh read straight out of a BinaryCache, the spans point into the mapped file
+	struct CachedAttributeArrays {
+		std::span<const float> xs;
+		std::span<const float> ys;
+		std::span<const float> zs;
+
+		size_t size() const noexcept;
+	};
+
+	struct CachedMesh {
+		std::span<const glm::vec3> vertices;
+		std::span<const glm::vec3> vertexTextureCoordinates;
+		std::span<const glm::vec3> vertexNormals;
+
+		objParser::CachedAttributeArrays vertexArrays;
+		objParser::CachedAttributeArrays vertexTextureCoordinateArrays;
+		objParser::CachedAttributeArrays vertexNormalArrays;
+
+		std::span<const objParser::Index> vertexIndexes;
+		std::span<const objParser::Index> vertexTextureCoordinatesIndexes;
+		std::span<const objParser::Index> vertexNormalsIndexes;
+
+		size_t mtlIndex;
+		std::string_view name;
+		std::span<const objParser::MaterialRange> materialRanges;
+
+		size_t vertexCount() const noexcept;
+		size_t vertexTextureCoordinateCount() const noexcept;
+		size_t vertexNormalCount() const noexcept;
+	};
+
+	struct CachedMaterial {
+		std::string_view name;
+		glm::vec3 ambientColor;
+		glm::vec3 diffuseColor;
+		glm::vec3 specularColor;
+		float specularExponent;
+		float transparent;
+		glm::vec3 transmissionFilter;
+		float indexOfRefraction;
+	};
+
+	// a cache file mapped into memory, everything it hands out is only valid until it is closed
+	class BinaryCache {
+	public:
+		BinaryCache() noexcept;
+
+		// checks the header and that every array is inside the file, so mesh and material never have to
+		// the checksum reads the whole file, skipping it leaves the pages to be faulted in as they are used
+		objParser::Error open(const std::filesystem::path& fileName, const objParser::ParseOptions& options = {}, bool verifyChecksum = true);
+		void close() noexcept;
+
+		bool isOpen() const noexcept;
+
+		size_t meshCount() const noexcept;
+		size_t materialCount() const noexcept;
+		size_t dependencyCount() const noexcept;
+
+		objParser::CachedMesh mesh(size_t i) const noexcept;
+		objParser::CachedMaterial material(size_t i) const noexcept;
+		objParser::CacheDependency dependency(size_t i) const;
+
+		// copies every mesh and material out, see loadBinaryCache
+		void load(objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials) const;
+
+	private:
+		objParser::MappedFile file;
+		std::span<const objParser::BinaryCacheMeshRecord> meshRecords;
+		std::span<const objParser::BinaryCacheMaterialRecord> materialRecords;
+		std::span<const objParser::BinaryCacheDependencyRecord> dependencyRecords;
+	};
+
+	// writes meshs and materials as a cache, replacing whatever is at fileName
+	// dependencies are only stored, it is up to whoever opens the cache to check them
+	objParser::Error saveBinaryCache(const std::filesystem::path& fileName, std::span<const objParser::Mesh> meshs, std::span<const objParser::Material> materials, std::span<const objParser::CacheDependency> dependencies = {});
+
+	// copies a cache into meshs and materials, appending like parseObjFile does
+	// material indexes are moved along by materials.size(), so they still point at the material they did when saved
+	objParser::Error loadBinaryCache(const std::filesystem::path& fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+}
\ No newline at end of file
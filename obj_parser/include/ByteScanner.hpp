@@ -0,0 +1,44 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+namespace objParser {
+	enum class SimdLevel {
+		scalar,
+		sse2,
+		avx2,
+		avx512
+	};
+
+	std::ostream& operator<<(std::ostream& oss, const objParser::SimdLevel& level) noexcept;
+
+	// widest instruction set this cpu supports, worked out once at runtime
+	objParser::SimdLevel detectedSimdLevel() noexcept;
+
+	// the instruction set the scanners are using right now, defaults to detectedSimdLevel
+	objParser::SimdLevel activeSimdLevel() noexcept;
+
+	// force a narrower instruction set (for testing and benchmarking), anything wider than the cpu supports is clamped
+	// safe to call while another thread is parsing, a parse already running might carry on with either level
+	objParser::SimdLevel setSimdLevel(objParser::SimdLevel level) noexcept;
+
+	// first '\n' in [begin, end), or end if there isnt one
+	const char* findNewline(const char* begin, const char* end) noexcept;
+
+	// hands out the lines of a buffer one at a time
+	// newlines are found 64 bytes at a time and kept as a bit mask, so each byte is only looked at once however short the lines are
+	class LineSplitter {
+	public:
+		LineSplitter(std::string_view buffer) noexcept;
+
+		// the line doesnt include the '\n', an empty last line after a final '\n' isnt returned
+		bool next(std::string_view& line) noexcept;
+
+	private:
+		void loadBlock() noexcept;
+
+		const char* lineStart;
+		const char* blockStart;
+		const char* end;
+		uint64_t newlineMask;
+	};
+}
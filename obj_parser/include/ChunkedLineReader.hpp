@@ -0,0 +1,29 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <memory_resource>
+
+namespace objParser {
+	// reads a stream one line at a time through a fixed size buffer that is refilled as lines are used up
+	// lines come out as views into the buffer, so nothing is allocated per line
+	class ChunkedLineReader {
+	public:
+		static constexpr size_t defaultChunkSize = 64 * 1024;
+
+		// the buffer comes from resource, a parse hands in its scratch arena
+		ChunkedLineReader(std::istream& stream, size_t chunkSize = defaultChunkSize, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+		// the view is only valid until the next call
+		bool nextLine(std::string_view& line);
+
+	private:
+		bool refill();
+
+		std::istream& stream;
+		std::pmr::vector<char> buffer;
+		size_t lineStart;
+		size_t scanStart;
+		size_t dataEnd;
+		bool streamDone;
+	};
+}
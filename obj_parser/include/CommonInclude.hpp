@@ -1,7 +1,11 @@
 #pragma once
 #include <vector>
 #include <string> 
+#include <string_view>
 #include <array>
+#include <span>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -10,5 +14,23 @@
 
 #include "ext/glm/glm.hpp"
 
+// define OBJ_PARSER_PMR before including the parser (the same everywhere) to build Mesh, Material and the parse results on std::pmr
+// everything the parser outputs then comes from the memory resource of the vectors handed to it
+#ifdef OBJ_PARSER_PMR
+	#include <memory_resource>
+#endif
+
+namespace objParser {
+#ifdef OBJ_PARSER_PMR
+	template <typename T>
+	using Vector = std::pmr::vector<T>;
+	using String = std::pmr::string;
+#else
+	template <typename T>
+	using Vector = std::vector<T>;
+	using String = std::string;
+#endif
+}
+
 //#include "ext/stb/stb_image.h" 
 //#include "ext/stb/stb_image_write.h"
\ No newline at end of file
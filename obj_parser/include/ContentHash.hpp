@@ -0,0 +1,31 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <cstdint>
+#include <filesystem>
+
+namespace objParser {
+	// a fast non cryptographic 64 bit hash, fed a piece at a time
+	// four independent lanes of multiply and rotate over 32 byte stripes, then folded together like xxhash does
+	// the result only depends on the bytes, not on how they were split up between update calls
+	class ContentHash {
+	public:
+		ContentHash() noexcept;
+
+		void update(const void* data, size_t size) noexcept;
+		uint64_t finish() const noexcept;
+
+	private:
+		static constexpr size_t stripeSize = 32;
+
+		uint64_t lanes[4];
+		unsigned char pending[stripeSize];
+		size_t pendingBytes;
+		uint64_t length;
+
+		void stripe(const unsigned char* bytes) noexcept;
+	};
+
+	// streams the whole file through a ContentHash
+	objParser::Error hashFile(const std::filesystem::path& fileName, uint64_t& hash);
+}
\ No newline at end of file
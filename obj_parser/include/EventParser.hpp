@@ -0,0 +1,288 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "LineTokenizer.hpp"
+#include "ByteScanner.hpp"
+#include "ChunkedLineReader.hpp"
+#include "ParseOptions.hpp"
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+
+/*
+ * The event parser reads an obj file and calls a handler for every statement in it, without building anything itself
+ * The handler is a template parameter, so its calls are inlined into the line loop, and the loop allocates nothing
+ * Every callback returns an objParser::Error, anything but OK stops the parse and is what it returns
+ *
+ *     struct CountVertices {
+ *         size_t count = 0;
+ *         objParser::Error onVertex(float x, float y, float z, float w) { count++; return objParser::ErrorType::OK; }
+ *         ... and the rest of ObjHandler
+ *     };
+ *
+ * Numbers are passed on as written (a normal isnt normalized, w isnt divided out) and face indices arent resolved,
+ * the handler knows what its indices count from, resolveFaceIndex does the counting for it
+ * parseObjStream and parseObjBuffer are built on this, with a handler that fills in Meshs
+ *
+ * The attributes template argument picks the statements that are read, the handler is never called for the rest
+ * and their lines are passed over once their keyword is known, without reading a number or checking what is on them
+ *
+ *     objParser::parseObj<objParser::Attributes::positions>(buffer, countVertices);
+ */
+
+namespace objParser {
+	enum class ObjKeyword {
+		empty,
+		comment,
+		object,
+		vertex,
+		vertexNormal,
+		vertexTexture,
+		face,
+		useMaterial,
+		materialLibrary,
+		unknown
+	};
+
+	// works out the statement from its first one or two bytes, only the rare long keywords need a full compare
+	objParser::ObjKeyword classifyKeyword(std::string_view keyword) noexcept;
+
+	// which indices every corner of a face has, v, v/vt, v//vn or v/vt/vn
+	enum class FaceFormat {
+		notSet,
+		v,
+		vvt,
+		vvn,
+		vvtvn
+	};
+
+	// one corner of a face as it is written, 1 based or negative counting back from the end, 0 where the format doesnt have it
+	// wider than any index type, so an index can be checked against objParser::Index before its stored
+	struct FaceCorner {
+		int64_t v = 0;
+		int64_t vt = 0;
+		int64_t vn = 0;
+		objParser::FaceFormat format = objParser::FaceFormat::notSet;
+	};
+
+	// decodes one v, v/vt, v//vn or v/vt/vn element, format is set even when it fails
+	bool decodeFaceCorner(std::string_view text, objParser::FaceCorner& corner) noexcept;
+
+	// turns an index as written into a 0 based one into a list of count, false if it is outside the list
+	bool resolveFaceIndex(int64_t& index, size_t count) noexcept;
+
+	// the corners of one face, every one of them already checked to decode and to be in the same format
+	// the first few are kept decoded, the rest are decoded again from the line as they are iterated, so a polygon of any size costs no memory
+	class FaceCorners {
+	public:
+		static constexpr size_t inlineCorners = 4;
+
+		class Iterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = objParser::FaceCorner;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const objParser::FaceCorner*;
+			using reference = const objParser::FaceCorner&;
+
+			Iterator() noexcept;
+			Iterator(const FaceCorners* corners, size_t index) noexcept;
+
+			const objParser::FaceCorner& operator*() const noexcept;
+			const objParser::FaceCorner* operator->() const noexcept;
+			Iterator& operator++() noexcept;
+			Iterator operator++(int) noexcept;
+
+			bool operator==(const Iterator& other) const noexcept;
+
+		private:
+			const FaceCorners* corners;
+			size_t index;
+			objParser::LineTokenizer rest;
+			objParser::FaceCorner current;
+		};
+
+		FaceCorners() noexcept;
+
+		size_t size() const noexcept;
+		objParser::FaceFormat format() const noexcept;
+		bool hasTextureCoordinates() const noexcept;
+		bool hasNormals() const noexcept;
+
+		Iterator begin() const noexcept;
+		Iterator end() const noexcept;
+
+		// reads the corners after an f, stopping at the first one that is wrong
+		objParser::Error read(objParser::LineTokenizer& lineTokens);
+
+	private:
+		std::array<objParser::FaceCorner, inlineCorners> first;
+		size_t count;
+		objParser::FaceFormat cornerFormat;
+
+		// the line from just after the inline corners
+		objParser::LineTokenizer rest;
+	};
+
+	template <typename Handler>
+	concept ObjHandler = requires(Handler& handler, std::string_view name, float value, const objParser::FaceCorners& corners) {
+		{ handler.onObject(name) } -> std::convertible_to<objParser::Error>;
+		{ handler.onVertex(value, value, value, value) } -> std::convertible_to<objParser::Error>;
+		{ handler.onNormal(value, value, value) } -> std::convertible_to<objParser::Error>;
+		{ handler.onTexCoord(value, value, value) } -> std::convertible_to<objParser::Error>;
+		{ handler.onFace(corners) } -> std::convertible_to<objParser::Error>;
+		{ handler.onUseMtl(name) } -> std::convertible_to<objParser::Error>;
+		{ handler.onMtlLib(name) } -> std::convertible_to<objParser::Error>;
+	};
+
+	// one line, without its '\n'
+	template <objParser::Attributes attributes = objParser::Attributes::all, objParser::ObjHandler Handler>
+	objParser::Error parseObjLine(std::string_view line, Handler& handler);
+
+	// every line of a buffer that is already in memory, stopping at the first error
+	template <objParser::Attributes attributes = objParser::Attributes::all, objParser::ObjHandler Handler>
+	objParser::Error parseObj(std::string_view buffer, Handler& handler);
+
+	// every line of a stream, the only memory this uses is the buffer the stream is read through, which comes from scratch
+	template <objParser::Attributes attributes = objParser::Attributes::all, objParser::ObjHandler Handler>
+	objParser::Error parseObj(std::istream& stream, Handler& handler, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+	// the errors the event parser gives for lines it cant read
+	objParser::Error unexpectedLineStart(std::string_view keyword);
+	objParser::Error attributeReadError(objParser::ObjKeyword keyword);
+}
+
+template <objParser::Attributes attributes, objParser::ObjHandler Handler>
+objParser::Error objParser::parseObjLine(std::string_view line, Handler& handler) {
+	objParser::LineTokenizer lineTokens(line);
+
+	std::string_view keyword;
+	lineTokens.next(keyword);
+
+	objParser::ObjKeyword statement = objParser::classifyKeyword(keyword);
+
+	switch (statement) {
+	case objParser::ObjKeyword::vertex: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::positions)) {
+			return objParser::ErrorType::OK;
+		}
+
+		// w is optional
+		float x = 0, y = 0, z = 0, w = 1.0f;
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
+			return objParser::attributeReadError(statement);
+		}
+		lineTokens.next(w);
+
+		return handler.onVertex(x, y, z, w);
+	}
+
+	case objParser::ObjKeyword::face: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::faces)) {
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::FaceCorners corners;
+		objParser::Error error = corners.read(lineTokens);
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+
+		return handler.onFace(corners);
+	}
+
+	case objParser::ObjKeyword::vertexNormal: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::normals)) {
+			return objParser::ErrorType::OK;
+		}
+
+		float x = 0, y = 0, z = 0;
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
+			return objParser::attributeReadError(statement);
+		}
+
+		return handler.onNormal(x, y, z);
+	}
+
+	case objParser::ObjKeyword::vertexTexture: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::textureCoordinates)) {
+			return objParser::ErrorType::OK;
+		}
+
+		// the last two are optional and default to zero
+		float u = 0, v = 0, w = 0;
+		if (!lineTokens.next(u)) {
+			return objParser::attributeReadError(statement);
+		}
+		lineTokens.next(v);
+		lineTokens.next(w);
+
+		return handler.onTexCoord(u, v, w);
+	}
+
+	case objParser::ObjKeyword::object: {
+		std::string_view name;
+		lineTokens.next(name);
+		return handler.onObject(name);
+	}
+
+	case objParser::ObjKeyword::useMaterial: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::faces)) {
+			return objParser::ErrorType::OK;
+		}
+
+		std::string_view name;
+		lineTokens.next(name);
+		return handler.onUseMtl(name);
+	}
+
+	case objParser::ObjKeyword::materialLibrary: {
+		if constexpr (!objParser::hasAttributes(attributes, objParser::Attributes::faces)) {
+			return objParser::ErrorType::OK;
+		}
+
+		std::string_view fileName;
+		lineTokens.next(fileName);
+		return handler.onMtlLib(fileName);
+	}
+
+	case objParser::ObjKeyword::comment:
+	case objParser::ObjKeyword::empty:
+		return objParser::ErrorType::OK;
+
+	default:
+		return objParser::unexpectedLineStart(keyword);
+	}
+}
+
+template <objParser::Attributes attributes, objParser::ObjHandler Handler>
+objParser::Error objParser::parseObj(std::string_view buffer, Handler& handler) {
+	objParser::LineSplitter lines(buffer);
+	std::string_view line;
+	while (lines.next(line)) {
+		objParser::Error error = objParser::parseObjLine<attributes>(line, handler);
+
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+	}
+
+	return objParser::ErrorType::OK;
+}
+
+template <objParser::Attributes attributes, objParser::ObjHandler Handler>
+objParser::Error objParser::parseObj(std::istream& stream, Handler& handler, std::pmr::memory_resource* scratch) {
+	objParser::ChunkedLineReader lineReader(stream, objParser::ChunkedLineReader::defaultChunkSize, scratch);
+
+	std::string_view line;
+	while (lineReader.nextLine(line)) {
+		objParser::Error error = objParser::parseObjLine<attributes>(line, handler);
+
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+	}
+
+	return objParser::ErrorType::OK;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <cstdint>
+
+namespace objParser {
+	// reads whitespace separated tokens and numbers out of a single line without allocating
+	// it behaves like the istringstream it replaces: once a read fails, every read after it fails too
+	class LineTokenizer {
+	public:
+		LineTokenizer() noexcept;
+		LineTokenizer(std::string_view line) noexcept;
+
+		void reset(std::string_view line) noexcept;
+
+		bool next(std::string_view& token) noexcept;
+		bool next(float& value) noexcept;
+		bool next(int& value) noexcept;
+		bool next(int64_t& value) noexcept;
+
+		bool fail() const noexcept;
+
+		// true if there is nothing but whitespace left on the line
+		bool atEnd() noexcept;
+
+	private:
+		bool skipWhitespace() noexcept;
+
+		const char* cursor;
+		const char* end;
+		bool failed;
+	};
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "ParseOptions.hpp"
+#include <filesystem>
+#include <string_view>
+
+namespace objParser {
+	// read only view of a whole file mapped into memory
+	// only regular files can be mapped, anything else makes open fail so the caller can fall back to a stream
+	class MappedFile {
+	public:
+		MappedFile() noexcept;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		objParser::Error open(const std::filesystem::path& fileName, const objParser::ParseOptions& options = {});
+		void close() noexcept;
+
+		bool isOpen() const noexcept;
+		std::string_view view() const noexcept;
+
+	private:
+		const char* mappedData;
+		size_t mappedSize;
+		bool opened;
+
+#ifdef _WIN32
+		void* fileHandle;
+		void* mappingHandle;
+#endif
+	};
+}
@@ -1,9 +1,11 @@
 #pragma once
 #include "CommonInclude.hpp"
 
+#include <unordered_map>
+
 namespace objParser { 
     struct Material { 
-        std::string name;
+        objParser::String name;
 		glm::vec3 ambientColor = glm::vec3(0.0f, 0.0f, 0.0f);		// Ka
 		glm::vec3 diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f);		// Kd
 		glm::vec3 specularColor = glm::vec3(0.0f, 0.0f, 0.0f);		// Ks
@@ -13,6 +15,36 @@ namespace objParser {
 		float indexOfRefraction = 0.0f;								// Ni / index of refraction
 
  
+#ifdef OBJ_PARSER_PMR
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+
+		Material(std::string_view name, const allocator_type& allocator = {});
+		Material(const Material& other, const allocator_type& allocator);
+		Material(Material&& other, const allocator_type& allocator);
+		Material(const Material& other) = default;
+		Material(Material&& other) = default;
+		Material& operator=(const Material& other) = default;
+		Material& operator=(Material&& other) = default;
+#else
         Material(const std::string& name); 
+#endif
     };
+
+	// hashes std::string and std::string_view the same way, so a name can be looked up without making a string out of it
+	struct MaterialNameHash {
+		using is_transparent = void;
+
+		size_t operator()(std::string_view name) const noexcept;
+	};
+
+	// material name to where it is in the materials vector, look names up with find(std::string_view)
+	// a name thats in there more than once maps to the first one, which is the one usemtl picks
+#ifdef OBJ_PARSER_PMR
+	using MaterialIndexes = std::pmr::unordered_map<objParser::String, size_t, objParser::MaterialNameHash, std::equal_to<>>;
+#else
+	using MaterialIndexes = std::unordered_map<objParser::String, size_t, objParser::MaterialNameHash, std::equal_to<>>;
+#endif
+
+	// adds materials from first on to indexes, names already in there keep the index they had
+	void indexMaterials(std::span<const objParser::Material> materials, objParser::MaterialIndexes& indexes, size_t first = 0);
 }
\ No newline at end of file
@@ -1,19 +1,110 @@
 #pragma once
 #include "CommonInclude.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// the type every face index is stored as, define this before including the parser (the same everywhere) to change it
+// uint16_t or uint32_t halve the index memory of small meshs, int64_t or uint64_t lift the 2^31 limit for huge ones
+// faces that index past what it can hold fail to parse
+#ifndef OBJ_PARSER_INDEX_TYPE
+	#define OBJ_PARSER_INDEX_TYPE int
+#endif
+
 namespace objParser {
+	using Index = OBJ_PARSER_INDEX_TYPE;
+	static_assert(std::is_integral_v<objParser::Index> && sizeof(objParser::Index) >= 2, "OBJ_PARSER_INDEX_TYPE has to be an integer type of at least 16 bits");
+
+	// one attribute as a structure of arrays, element i is (x[i], y[i], z[i])
+	// filled instead of the glm::vec3 vectors when parsing with AttributeLayout::structOfArrays
+	struct AttributeArrays {
+		objParser::Vector<float> xs;
+		objParser::Vector<float> ys;
+		objParser::Vector<float> zs;
+
+#ifdef OBJ_PARSER_PMR
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+
+		AttributeArrays() = default;
+		explicit AttributeArrays(const allocator_type& allocator);
+		AttributeArrays(const AttributeArrays& other, const allocator_type& allocator);
+		AttributeArrays(AttributeArrays&& other, const allocator_type& allocator);
+		AttributeArrays(const AttributeArrays& other) = default;
+		AttributeArrays(AttributeArrays&& other) = default;
+		AttributeArrays& operator=(const AttributeArrays& other) = default;
+		AttributeArrays& operator=(AttributeArrays&& other) = default;
+#endif
+
+		std::span<const float> x() const noexcept;
+		std::span<const float> y() const noexcept;
+		std::span<const float> z() const noexcept;
+
+		std::span<float> x() noexcept;
+		std::span<float> y() noexcept;
+		std::span<float> z() noexcept;
+
+		size_t size() const noexcept;
+		bool empty() const noexcept;
+
+		void push_back(float x, float y, float z);
+		void reserve(size_t size);
+		void append(const AttributeArrays& other);
+	};
+
+	// a run of faces that all use one material, counted in entries of the index vectors (3 per triangle)
+	// the index buffer from buildVertexBuffer keeps the same order, so the ranges can be drawn from it directly
+	struct MaterialRange {
+		size_t firstIndex;
+		size_t indexCount;
+		size_t mtlIndex;
+
+		bool operator==(const MaterialRange& other) const = default;
+	};
+
+	// what Mesh::mtlIndex holds until a usemtl sets it
+	constexpr size_t noMaterial = std::numeric_limits<size_t>::max();
+
 	struct Mesh {
-		std::vector<glm::vec3> vertices;
-		std::vector<glm::vec3> vertexTextureCoordinates;
-		std::vector<glm::vec3> vertexNormals;
+		objParser::Vector<glm::vec3> vertices;
+		objParser::Vector<glm::vec3> vertexTextureCoordinates;
+		objParser::Vector<glm::vec3> vertexNormals;
 
-		std::vector<int> vertexIndexes;
-		std::vector<int> vertexTextureCoordinatesIndexes;
-		std::vector<int> vertexNormalsIndexes;
+		// the same attributes in structure of arrays layout, only one of the two layouts is filled by a parse
+		AttributeArrays vertexArrays;
+		AttributeArrays vertexTextureCoordinateArrays;
+		AttributeArrays vertexNormalArrays;
+
+		objParser::Vector<objParser::Index> vertexIndexes;
+		objParser::Vector<objParser::Index> vertexTextureCoordinatesIndexes;
+		objParser::Vector<objParser::Index> vertexNormalsIndexes;
 		
-		size_t mtlIndex;
-		std::string name;
+		// the material set by the last usemtl, noMaterial if there wasnt one
+		size_t mtlIndex = objParser::noMaterial;
+		objParser::String name;
+
+		// one draw per range, in face order, neighbouring usemtls of the same material are merged
+		// faces before the first usemtl arent in any range, they are always the ones before materialRanges.front()
+		objParser::Vector<objParser::MaterialRange> materialRanges;
 
+#ifdef OBJ_PARSER_PMR
+		// a std::pmr::vector<Mesh> hands its resource to every mesh it makes, and each mesh on to all of its vectors
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+
+		Mesh(std::string_view name, const allocator_type& allocator = {});
+		Mesh(const Mesh& other, const allocator_type& allocator);
+		Mesh(Mesh&& other, const allocator_type& allocator);
+		Mesh(const Mesh& other) = default;
+		Mesh(Mesh&& other) = default;
+		Mesh& operator=(const Mesh& other) = default;
+		Mesh& operator=(Mesh&& other) = default;
+#else
 		Mesh(std::string name);
+#endif
+
+		// counts whichever layout the attribute is stored in, this is what face indices index into
+		size_t vertexCount() const noexcept;
+		size_t vertexTextureCoordinateCount() const noexcept;
+		size_t vertexNormalCount() const noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "Mesh.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+
+/*
+ * What parseObjMeshs gives back, each Mesh of the file one at a time, as soon as the o after it is read
+ * Nothing is parsed until it is iterated, and then only as far as the next finished mesh
+ *
+ *     objParser::MeshGenerator meshs = objParser::parseObjMeshs("scene.obj", materials);
+ *     for (objParser::Mesh& mesh : meshs) {
+ *         upload(std::move(mesh));
+ *     }
+ *     if (meshs.error() != objParser::ErrorType::OK) ...
+ *
+ * The mesh can be moved out of, it is dropped either way when the next one is parsed
+ * Of the ParseOptions, memoryMap, prefault, hugePages, threadCount, minimumChunkSize, reserveExact, cacheDirectory and cacheSizeLimit arent used
+ * scratchStatistics is written each time a mesh is given out and again when the parse ends
+ * This is the same idea as std::generator, which gcc 12 and clang 16 dont have yet
+ */
+
+namespace objParser {
+	class MeshGenerator {
+	public:
+		struct promise_type {
+			// the mesh the parse is stopped on, it is still in the coroutine frame
+			objParser::Mesh* current = nullptr;
+			objParser::Error error;
+			std::exception_ptr exception;
+
+			objParser::MeshGenerator get_return_object() noexcept;
+			std::suspend_always initial_suspend() const noexcept;
+			std::suspend_always final_suspend() const noexcept;
+			std::suspend_always yield_value(objParser::Mesh&& mesh) noexcept;
+			void return_value(objParser::Error error) noexcept;
+			void unhandled_exception() noexcept;
+		};
+
+		class Iterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = objParser::Mesh;
+			using difference_type = std::ptrdiff_t;
+
+			Iterator() noexcept;
+			explicit Iterator(std::coroutine_handle<promise_type> handle) noexcept;
+
+			objParser::Mesh& operator*() const noexcept;
+			objParser::Mesh* operator->() const noexcept;
+
+			// parses up to the next mesh, rethrowing anything the parse threw (std::bad_alloc)
+			Iterator& operator++();
+			void operator++(int);
+
+			bool operator==(std::default_sentinel_t) const noexcept;
+
+		private:
+			std::coroutine_handle<promise_type> handle;
+		};
+
+		MeshGenerator() noexcept;
+		explicit MeshGenerator(std::coroutine_handle<promise_type> handle) noexcept;
+		MeshGenerator(MeshGenerator&& other) noexcept;
+		MeshGenerator& operator=(MeshGenerator&& other) noexcept;
+		MeshGenerator(const MeshGenerator&) = delete;
+		MeshGenerator& operator=(const MeshGenerator&) = delete;
+		~MeshGenerator();
+
+		// starts the parse, so it can only be called once
+		Iterator begin();
+		std::default_sentinel_t end() const noexcept;
+
+		// OK until the parse stops, then whatever stopped it
+		// the meshs before an error were all given out finished, the one it was in the middle of isnt given out at all
+		objParser::Error error() const noexcept;
+
+	private:
+		std::coroutine_handle<promise_type> handle;
+	};
+}
\ No newline at end of file
@@ -2,9 +2,14 @@
 #include "CommonInclude.hpp"
 
 #include "Material.hpp"
+#include "ParseOptions.hpp"
 #include <filesystem>
 
 namespace objParser {
-	objParser::Error parseMtlFile(std::filesystem::path fileName, std::vector<objParser::Material>& materials);
-	objParser::Error parseMtlStream(std::istream& stream, const std::filesystem::path& fileName, std::vector<objParser::Material>& materials);
+	objParser::Error parseMtlFile(std::filesystem::path fileName, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+	objParser::Error parseMtlStream(std::istream& stream, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials);
+
+	// parse an mtl file that is already in memory, the buffer is read in place and never copied
+	objParser::Error parseMtlBuffer(std::string_view buffer, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials);
+	objParser::Error parseMtlBuffer(std::span<const std::byte> buffer, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials);
 }
\ No newline at end of file
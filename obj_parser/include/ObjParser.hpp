@@ -3,12 +3,29 @@
 
 #include "Mesh.hpp"
 #include "Material.hpp"
+#include "ParseOptions.hpp"
+#include "MeshGenerator.hpp"
 
 #include <cctype>
 #include <filesystem>
 #include <algorithm>
 
 namespace objParser {
-	objParser::Error parseObjFile(std::filesystem::path fileName, std::vector<Mesh>& meshs, std::vector<objParser::Material>& materials); 
-	objParser::Error parseObjStream(std::istream& stream, const std::filesystem::path& objPath, std::vector<Mesh>& meshs, std::vector<objParser::Material>& materials);
+	objParser::Error parseObjFile(std::filesystem::path fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+	// always parses on the calling thread, a stream cant be split up without reading all of it first
+	// so the memory map, chunk and reserve options arent used
+	objParser::Error parseObjStream(std::istream& stream, const std::filesystem::path& objPath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+
+	// parse an obj file that is already in memory, the buffer is read in place and never copied
+	// options.threadCount splits it across threads
+	objParser::Error parseObjBuffer(std::string_view buffer, const std::filesystem::path& objPath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+	objParser::Error parseObjBuffer(std::span<const std::byte> buffer, const std::filesystem::path& objPath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options = {});
+
+	// gives out each mesh as soon as it is finished instead of all of them at the end, see MeshGenerator.hpp
+	// the file is read through a stream a chunk at a time, so all that is held at once is that chunk and the mesh being parsed
+	// (and every v, vt and vn with FaceIndexing::fileWide, a face could point at any of them)
+	// materials are added to as mtllib lines are read, it has to outlive the generator, as does the stream
+	// like parseObjStream the memory map, thread, reserve and cache options arent used (MeshGenerator.hpp has the list)
+	objParser::MeshGenerator parseObjMeshs(std::filesystem::path fileName, objParser::Vector<objParser::Material>& materials, objParser::ParseOptions options = {});
+	objParser::MeshGenerator parseObjMeshs(std::istream& stream, std::filesystem::path objPath, objParser::Vector<objParser::Material>& materials, objParser::ParseOptions options = {});
 }
\ No newline at end of file
@@ -7,7 +7,8 @@ namespace objParser {
 	enum ErrorType {
 		OK,
 		FileFormatError,
-		FileNotFound
+		FileNotFound,
+		FileWriteError
 	};
 
 	std::ostream& operator<<(std::ostream& oss, const objParser::ErrorType& error) noexcept;
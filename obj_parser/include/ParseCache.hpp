@@ -0,0 +1,27 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "Mesh.hpp"
+#include "Material.hpp"
+#include "ParseOptions.hpp"
+#include <cstdint>
+#include <filesystem>
+
+/*
+ * The parse cache is a directory of binary caches (see BinaryCache.hpp), one per parsed file, shared by everything pointed at it
+ * An entry is named after a ContentHash of the obj file's contents, where it is, and the options that change what it parses to
+ * Each entry also holds the ContentHash of every mtl file the parse loaded, a changed mtl file means the entry isnt used
+ * Entries are written to a temporary file and renamed into place, so a reader (in this process or another) only ever sees whole ones
+ * Using an entry bumps its last write time, which is what the least recently used ones are picked by when the directory gets too big
+ */
+
+namespace objParser {
+	// what parseObjFile does when options.cacheDirectory is set
+	// meshs and materials have to start empty for the cache to be used, otherwise this is just parseObjFile
+	// the cache is only ever a shortcut, if it cant be read or written the file is parsed as normal
+	objParser::Error parseObjFileCached(const std::filesystem::path& fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options);
+
+	// deletes the least recently used entries in directory until the rest add up to at most sizeLimit bytes
+	// and any temporary file a writer that died has left behind
+	void trimParseCache(const std::filesystem::path& directory, uint64_t sizeLimit);
+}
\ No newline at end of file
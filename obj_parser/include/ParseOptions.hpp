@@ -0,0 +1,124 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Material.hpp"
+
+namespace objParser {
+	struct ScratchStatistics;
+
+	// how v, vt and vn are stored in a Mesh
+	enum class AttributeLayout {
+		// std::vector<glm::vec3>, Mesh::vertices etc
+		arrayOfStructs,
+		// separate x, y and z arrays, Mesh::vertexArrays etc
+		structOfArrays
+	};
+
+	// what the numbers in a face count through
+	enum class FaceIndexing {
+		// each o starts counting its own v, vt and vn from 1 again, what this parser has always done
+		perObject,
+		// what the obj spec says, a face can use any v, vt or vn from earlier in the file, whichever object it came after
+		// they all go in one pool first, then each mesh is given only the ones its faces use, kept in file order
+		// so v, vt and vn lines are fine before the first o, and ones no face uses arent in any mesh
+		fileWide
+	};
+
+	// what happens to a face with more than 3 corners
+	enum class Triangulation {
+		// its a FileFormatError, what this parser has always done
+		none,
+		// fanned out from the first corner, the fastest, and right for any convex polygon
+		fan,
+		// quads are split along whichever diagonal stays inside them, bigger polygons are fanned when convex and ear clipped when not
+		earClipping
+	};
+
+	// the statements a parse reads, the lines of everything else are passed over without reading a number from them
+	// usemtl and mtllib come with faces, a material range is a range of faces
+	enum class Attributes : uint8_t {
+		none = 0,
+		positions = 1 << 0,
+		textureCoordinates = 1 << 1,
+		normals = 1 << 2,
+		faces = 1 << 3,
+		all = positions | textureCoordinates | normals | faces
+	};
+
+	constexpr objParser::Attributes operator|(objParser::Attributes a, objParser::Attributes b) noexcept {
+		return static_cast<objParser::Attributes>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+	}
+
+	constexpr objParser::Attributes operator&(objParser::Attributes a, objParser::Attributes b) noexcept {
+		return static_cast<objParser::Attributes>(static_cast<uint8_t>(a) & static_cast<uint8_t>(b));
+	}
+
+	// true if every attribute in wanted is in attributes
+	constexpr bool hasAttributes(objParser::Attributes attributes, objParser::Attributes wanted) noexcept {
+		return (attributes & wanted) == wanted;
+	}
+
+	struct ParseOptions {
+		// map the file into memory and parse straight out of the mapped pages
+		// falls back to reading through a stream if the file cant be mapped (pipes, devices etc)
+		bool memoryMap = true;
+
+		// fault in every page when the file is mapped instead of on first touch (MAP_POPULATE, linux only)
+		bool prefault = false;
+
+		// ask the os to back the mapping with huge pages where it can (MADV_HUGEPAGE, linux only)
+		bool hugePages = false;
+
+		// threads to parse one obj file with, 0 uses one per hardware thread
+		// the file is split at line boundaries and stitched back together, the result is exactly what one thread gives
+		unsigned threadCount = 1;
+
+		// the smallest piece of a file worth giving its own thread
+		size_t minimumChunkSize = 1 << 20;
+
+		// count every attribute with a quick pass over the file first, then reserve each mesh once
+		// costs an extra pass, but the vectors never reallocate, so peak memory isnt doubled while a big mesh grows
+		// only used when the whole file is in memory (parseObjBuffer or a mapped file)
+		bool reserveExact = false;
+
+		// which of the Mesh attribute layouts the parser fills, the other one is left empty
+		objParser::AttributeLayout layout = objParser::AttributeLayout::arrayOfStructs;
+
+		// reorder each mesh's faces by material once it is parsed, so every material is one Mesh::materialRanges entry
+		// the order is kept within a material, a mesh that mixes faces with and without vt or vn is left as it is
+		bool sortFacesByMaterial = false;
+
+		// a face with n corners becomes n - 2 triangles, one after the other in the index vectors
+		objParser::Triangulation triangulation = objParser::Triangulation::none;
+
+		// the statements to read, a mesh only gets the vectors these fill, so positions on their own is just Mesh::vertices
+		// the line loop is compiled once per mask, so a skipped line costs finding its keyword and nothing else, and it isnt checked either
+		// a face needs the positions it points at, so faces reads them even when positions isnt in here
+		objParser::Attributes attributes = objParser::Attributes::all;
+
+		// the handing out of a file wide pool (and the sort) is done per mesh on threadCount threads, even for a stream
+		objParser::FaceIndexing faceIndexing = objParser::FaceIndexing::perObject;
+
+		// if set, filled with what the parse's scratch arenas did (see ScratchArena.hpp)
+		// thats the scratch memory only, the vectors that end up in meshs and materials arent counted in heapAllocations
+		objParser::ScratchStatistics* scratchStatistics = nullptr;
+
+		// if set, the parse looks usemtl names up in here, and leaves it holding every material in materials by name
+		// whatever was in it before is thrown away
+		objParser::MaterialIndexes* materialIndexes = nullptr;
+
+		// if set, every mtl file the parse tried to load is added to it, once each and in the order they were loaded
+		// ones that couldnt be read are in there too
+		std::vector<std::filesystem::path>* materialLibraries = nullptr;
+
+		// if set, parseObjFile keeps binary caches of what it parses in this directory (see ParseCache.hpp)
+		// a file whose contents, mtl files and result changing options havent changed since it was cached is loaded instead of parsed
+		std::filesystem::path cacheDirectory;
+
+		// once the caches in cacheDirectory add up to more than this many bytes, the least recently used ones are deleted
+		uint64_t cacheSizeLimit = uint64_t(1) << 32;
+	};
+}
\ No newline at end of file
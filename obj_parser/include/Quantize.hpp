@@ -0,0 +1,69 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "Mesh.hpp"
+#include <cstdint>
+
+namespace objParser {
+	enum class TextureCoordinateEncoding {
+		// ieee half floats, keeps uvs outside [0, 1] (tiling) and is exact for small values
+		half,
+		// 16 bit fixed point between the mesh's smallest and largest uv, even precision everywhere
+		unorm16
+	};
+
+	struct QuantizeOptions {
+		objParser::TextureCoordinateEncoding textureCoordinateEncoding = objParser::TextureCoordinateEncoding::half;
+	};
+
+	// a mesh with its attributes packed down for streaming, the face indices are kept exactly as they were
+	struct QuantizedMesh {
+		std::string name;
+		size_t mtlIndex;
+		std::vector<objParser::MaterialRange> materialRanges;
+
+		// x, y, z per vertex, 16 bit fixed point across the mesh's bounding box
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+		std::vector<uint16_t> positions;
+
+		// u, v per texture coordinate, w is dropped
+		// for unorm16 they are fixed point between textureCoordinateMin and textureCoordinateMax, like the positions
+		objParser::TextureCoordinateEncoding textureCoordinateEncoding;
+		glm::vec2 textureCoordinateMin;
+		glm::vec2 textureCoordinateMax;
+		std::vector<uint16_t> textureCoordinates;
+
+		// octahedral encoded, two snorm16 per normal, only the direction is kept
+		std::vector<int16_t> normals;
+
+		std::vector<objParser::Index> vertexIndexes;
+		std::vector<objParser::Index> vertexTextureCoordinatesIndexes;
+		std::vector<objParser::Index> vertexNormalsIndexes;
+
+		// the worst difference between the mesh and what decodes back out, measured over every attribute
+		// positions and uvs are the largest difference in any one component, normals are the largest angle in radians
+		float maxPositionError;
+		float maxTextureCoordinateError;
+		float maxNormalError;
+
+		QuantizedMesh();
+
+		size_t vertexCount() const noexcept;
+		size_t vertexTextureCoordinateCount() const noexcept;
+		size_t vertexNormalCount() const noexcept;
+
+		glm::vec3 position(size_t i) const noexcept;
+		glm::vec2 textureCoordinate(size_t i) const noexcept;
+
+		// unit length, a zero length normal comes back as (0, 0, 1)
+		glm::vec3 normal(size_t i) const noexcept;
+	};
+
+	// works on either Mesh attribute layout, the encoding uses the widest instruction set activeSimdLevel allows
+	// attributes that arent finite (nan or inf) cant be quantized and are a FileFormatError
+	objParser::Error quantizeMesh(const objParser::Mesh& mesh, objParser::QuantizedMesh& quantizedMesh, const objParser::QuantizeOptions& options = {});
+
+	uint16_t floatToHalf(float value) noexcept;
+	float halfToFloat(uint16_t half) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory_resource>
+#include <system_error>
+#include <thread>
+
+namespace objParser {
+	// threadCount from ParseOptions, 0 is one per core
+	inline unsigned resolveThreadCount(unsigned threadCount) noexcept {
+		return threadCount == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadCount;
+	}
+
+	// runs task(i) for every chunk on its own thread (chunk 0 on the calling one), then rethrows the first exception any of them threw
+	// if the os runs out of threads the chunk just runs on the calling thread instead
+	template <typename Task>
+	void runChunks(size_t chunkCount, const Task& task, std::pmr::memory_resource* scratch = std::pmr::get_default_resource()) {
+		std::pmr::vector<std::exception_ptr> exceptions(chunkCount, scratch);
+
+		auto runChunk = [&task, &exceptions](size_t i) {
+			try {
+				task(i);
+			} catch (...) {
+				exceptions[i] = std::current_exception();
+			}
+		};
+
+		std::pmr::vector<std::thread> threads(scratch);
+		threads.reserve(chunkCount);
+
+		for (size_t i = 1; i < chunkCount; i++) {
+			try {
+				threads.emplace_back(runChunk, i);
+			} catch (const std::system_error&) {
+				// out of threads, this one just runs here instead
+				runChunk(i);
+			}
+		}
+		if (chunkCount > 0) {
+			runChunk(0);
+		}
+
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		for (const std::exception_ptr& exception : exceptions) {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <memory_resource>
+
+namespace objParser {
+	// what the scratch arenas of one parse did
+	// only the scratch memory is in here, the meshs, materials and everything else handed back to the caller arent counted
+	struct ScratchStatistics {
+		// scratch allocations the arenas handed out
+		size_t allocations = 0;
+		size_t bytes = 0;
+
+		// blocks the arenas had to get from the heap, this stays the same however many lines the file has
+		size_t heapAllocations = 0;
+
+		objParser::ScratchStatistics& operator+=(const objParser::ScratchStatistics& other) noexcept;
+	};
+
+	// a bump allocator for the short lived memory of one parse call (counting passes, chunk bookkeeping, the stream buffer)
+	// its a std::pmr::monotonic_buffer_resource that starts in a few kilobytes inside the arena itself, counted on the way in and on the way to upstream
+	// nothing is freed on its own, it all goes in one shot when the arena is released or destroyed
+	// not thread safe, a parse on several threads gives each chunk its own
+	class ScratchArena : public std::pmr::memory_resource {
+	public:
+		static constexpr size_t inlineSize = 4 * 1024;
+
+		explicit ScratchArena(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept;
+
+		ScratchArena(const ScratchArena&) = delete;
+		ScratchArena& operator=(const ScratchArena&) = delete;
+
+		// gives back every block, anything allocated from the arena is gone after this
+		void release() noexcept;
+
+		const objParser::ScratchStatistics& statistics() const noexcept;
+
+	private:
+		// passes the blocks the monotonic resource asks for on to the real upstream, counting them
+		class CountingUpstream : public std::pmr::memory_resource {
+		public:
+			CountingUpstream(std::pmr::memory_resource* upstream, objParser::ScratchStatistics& statistics) noexcept;
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override;
+			void do_deallocate(void* pointer, size_t bytes, size_t alignment) noexcept override;
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+			std::pmr::memory_resource* upstream;
+			objParser::ScratchStatistics& statistics;
+		};
+
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) noexcept override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		alignas(std::max_align_t) std::byte inlineBuffer[inlineSize];
+		objParser::ScratchStatistics scratchStatistics;
+		CountingUpstream countingUpstream;
+		std::pmr::monotonic_buffer_resource buffer;
+	};
+}
\ No newline at end of file
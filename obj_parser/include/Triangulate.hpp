@@ -0,0 +1,16 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+
+namespace objParser {
+	// splits a polygon into positions.size() - 2 triangles, keeping its winding
+	// each triangle is written to triangles as three corners (0 to positions.size() - 1), so triangles needs 3 * (positions.size() - 2) room
+	// concave polygons are ear clipped, quads and convex polygons never allocate
+	// a polygon that crosses itself still gets the right number of triangles, they just might overlap
+	void triangulatePolygon(std::span<const glm::vec3> positions, std::span<uint32_t> triangles, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+	// the same split fanned out from the first corner, all a convex polygon needs and what a parse without positions does
+	void fanPolygon(size_t cornerCount, std::span<uint32_t> triangles) noexcept;
+}
\ No newline at end of file
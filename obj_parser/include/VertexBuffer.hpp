@@ -0,0 +1,49 @@
+#pragma once
+#include "CommonInclude.hpp"
+
+#include "Mesh.hpp"
+#include <cstdint>
+
+namespace objParser {
+	enum class VertexAttribute {
+		position,
+		textureCoordinate,
+		normal
+	};
+
+	// what goes into each interleaved vertex, everything is written as floats
+	struct VertexLayout {
+		// in the order they are interleaved
+		std::vector<objParser::VertexAttribute> attributes = { VertexAttribute::position, VertexAttribute::textureCoordinate, VertexAttribute::normal };
+
+		// obj texture coordinates have u, v and an optional w, most shaders only want u and v
+		unsigned textureCoordinateComponents = 2;
+
+		// floats in one vertex
+		size_t stride() const noexcept;
+
+		// where the attribute starts inside a vertex, in floats, or npos if the layout doesnt have it
+		size_t offset(objParser::VertexAttribute attribute) const noexcept;
+
+		static constexpr size_t npos = static_cast<size_t>(-1);
+	};
+
+	// a mesh welded into something a graphics api can draw straight away
+	// every unique (v, vt, vn) triple becomes one vertex, and each face corner is a single index into them
+	struct VertexBuffer {
+		objParser::VertexLayout layout;
+
+		// layout.stride() floats per vertex
+		std::vector<float> vertices;
+		std::vector<uint32_t> indices;
+
+		size_t vertexCount() const noexcept;
+	};
+
+	// an attribute the layout asks for but the mesh doesnt have (no vt in its faces for example) is written as zeros
+	// works on either Mesh attribute layout
+	objParser::Error buildVertexBuffer(const objParser::Mesh& mesh, objParser::VertexBuffer& vertexBuffer, const objParser::VertexLayout& layout = {});
+
+	// one vertex buffer per mesh, the meshs are shared out between threads (0 uses one per hardware thread)
+	objParser::Error buildVertexBuffers(std::span<const objParser::Mesh> meshs, std::vector<objParser::VertexBuffer>& vertexBuffers, const objParser::VertexLayout& layout = {}, unsigned threadCount = 0);
+}
\ No newline at end of file
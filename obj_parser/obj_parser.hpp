@@ -2,15 +2,43 @@
 #include "include/Mesh.hpp"
 #include "include/Material.hpp"
 #include "include/ObjParserError.hpp"
+#include "include/ParseOptions.hpp"
+#include "include/ScratchArena.hpp"
+#include "include/RunChunks.hpp"
+#include "include/ContentHash.hpp"
+#include "include/MappedFile.hpp"
+#include "include/LineTokenizer.hpp"
+#include "include/ChunkedLineReader.hpp"
+#include "include/ByteScanner.hpp"
+#include "include/EventParser.hpp"
+#include "include/Triangulate.hpp"
 #include "include/MtlParser.hpp"
+#include "include/MeshGenerator.hpp"
 #include "include/ObjParser.hpp"
+#include "include/VertexBuffer.hpp"
+#include "include/Quantize.hpp"
+#include "include/BinaryCache.hpp"
+#include "include/ParseCache.hpp"
 
 #ifdef OBJ_PARSER_IMPLEMENTATION
 
 #include "src/ObjParser/Mesh.cpp"
 #include "src/ObjParser/Material.cpp"
 #include "src/ObjParser/ObjParserError.cpp"
+#include "src/ObjParser/MappedFile.cpp"
+#include "src/ObjParser/ScratchArena.cpp"
+#include "src/ObjParser/ContentHash.cpp"
+#include "src/ObjParser/LineTokenizer.cpp"
+#include "src/ObjParser/ByteScanner.cpp"
+#include "src/ObjParser/ChunkedLineReader.cpp"
+#include "src/ObjParser/EventParser.cpp"
+#include "src/ObjParser/Triangulate.cpp"
 #include "src/ObjParser/MtlParser.cpp"
+#include "src/ObjParser/MeshGenerator.cpp"
 #include "src/ObjParser/ObjParser.cpp"
+#include "src/ObjParser/VertexBuffer.cpp"
+#include "src/ObjParser/Quantize.cpp"
+#include "src/ObjParser/BinaryCache.cpp"
+#include "src/ObjParser/ParseCache.cpp"
 
 #endif
\ No newline at end of file
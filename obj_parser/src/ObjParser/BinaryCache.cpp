@@ -0,0 +1,484 @@
+#include "../../include/BinaryCache.hpp"
+
+#include <type_traits>
+
+namespace BinaryCacheHelpers {
+	constexpr char magic[8] = { 'O', 'B', 'J', 'C', 'A', 'C', 'H', 'E' };
+	constexpr uint32_t byteOrder = 0x01020304;
+	constexpr uint64_t arrayAlignment = 16;
+	constexpr uint64_t noMaterialRecord = std::numeric_limits<uint64_t>::max();
+
+	static_assert(sizeof(objParser::BinaryCacheHeader) == 88, "the cache header is part of the file format");
+	static_assert(sizeof(objParser::BinaryCacheMeshRecord) == 280, "the cache mesh record is part of the file format");
+	static_assert(sizeof(objParser::BinaryCacheMaterialRecord) == 80, "the cache material record is part of the file format");
+	static_assert(sizeof(objParser::BinaryCacheDependencyRecord) == 40, "the cache dependency record is part of the file format");
+	static_assert(sizeof(glm::vec3) == 12 && std::is_trivially_copyable_v<glm::vec3>, "glm::vec3 is written to the cache as 3 floats");
+	static_assert(std::is_trivially_copyable_v<objParser::MaterialRange>, "MaterialRange is written to the cache as it is");
+
+	static uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	// the mesh's arrays next to where their record points, in the order they are laid out in the file
+	template <typename Record, typename View, typename Visit>
+	static void visitArrays(Record& record, View& mesh, Visit&& visit) {
+		visit(record.vertices, mesh.vertices);
+		visit(record.vertexTextureCoordinates, mesh.vertexTextureCoordinates);
+		visit(record.vertexNormals, mesh.vertexNormals);
+
+		visit(record.vertexArrays[0], mesh.vertexArrays.xs);
+		visit(record.vertexArrays[1], mesh.vertexArrays.ys);
+		visit(record.vertexArrays[2], mesh.vertexArrays.zs);
+		visit(record.vertexTextureCoordinateArrays[0], mesh.vertexTextureCoordinateArrays.xs);
+		visit(record.vertexTextureCoordinateArrays[1], mesh.vertexTextureCoordinateArrays.ys);
+		visit(record.vertexTextureCoordinateArrays[2], mesh.vertexTextureCoordinateArrays.zs);
+		visit(record.vertexNormalArrays[0], mesh.vertexNormalArrays.xs);
+		visit(record.vertexNormalArrays[1], mesh.vertexNormalArrays.ys);
+		visit(record.vertexNormalArrays[2], mesh.vertexNormalArrays.zs);
+
+		visit(record.vertexIndexes, mesh.vertexIndexes);
+		visit(record.vertexTextureCoordinatesIndexes, mesh.vertexTextureCoordinatesIndexes);
+		visit(record.vertexNormalsIndexes, mesh.vertexNormalsIndexes);
+
+		visit(record.materialRanges, mesh.materialRanges);
+	}
+
+	static objParser::CachedAttributeArrays viewOf(const objParser::AttributeArrays& arrays) noexcept {
+		return { arrays.xs, arrays.ys, arrays.zs };
+	}
+
+	static objParser::CachedMesh viewOf(const objParser::Mesh& mesh) noexcept {
+		objParser::CachedMesh view;
+		view.vertices = mesh.vertices;
+		view.vertexTextureCoordinates = mesh.vertexTextureCoordinates;
+		view.vertexNormals = mesh.vertexNormals;
+		view.vertexArrays = viewOf(mesh.vertexArrays);
+		view.vertexTextureCoordinateArrays = viewOf(mesh.vertexTextureCoordinateArrays);
+		view.vertexNormalArrays = viewOf(mesh.vertexNormalArrays);
+		view.vertexIndexes = mesh.vertexIndexes;
+		view.vertexTextureCoordinatesIndexes = mesh.vertexTextureCoordinatesIndexes;
+		view.vertexNormalsIndexes = mesh.vertexNormalsIndexes;
+		view.mtlIndex = mesh.mtlIndex;
+		view.name = mesh.name;
+		view.materialRanges = mesh.materialRanges;
+		return view;
+	}
+
+	// only ever points inside the file, open has already checked
+	template <typename T>
+	static std::span<const T> arrayAt(std::string_view file, const objParser::BinaryCacheArray& array) noexcept {
+		return std::span<const T>(reinterpret_cast<const T*>(file.data() + array.offset), static_cast<size_t>(array.count));
+	}
+
+	template <typename T>
+	static bool inFile(std::string_view file, const objParser::BinaryCacheArray& array) noexcept {
+		return array.offset % alignof(T) == 0 && array.offset <= file.size() && array.count <= (file.size() - array.offset) / sizeof(T);
+	}
+
+	// buffers the writes and keeps the checksum of everything after the header as it goes
+	class CacheWriter {
+	public:
+		explicit CacheWriter(std::ofstream& out) : out(out), written(0) {
+			buffer.reserve(bufferSize);
+		}
+
+		void write(const void* data, size_t size) {
+			const char* bytes = static_cast<const char*>(data);
+			written += size;
+
+			while (size != 0) {
+				size_t taken = std::min(size, bufferSize - buffer.size());
+				buffer.insert(buffer.end(), bytes, bytes + taken);
+				bytes += taken;
+				size -= taken;
+
+				if (buffer.size() == bufferSize) {
+					flush();
+				}
+			}
+		}
+
+		void padTo(uint64_t offset) {
+			constexpr char zeros[arrayAlignment] = {};
+			while (written < offset) {
+				write(zeros, static_cast<size_t>(std::min<uint64_t>(offset - written, arrayAlignment)));
+			}
+		}
+
+		void flush() {
+			checksum.update(buffer.data(), buffer.size());
+			out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			buffer.clear();
+		}
+
+		uint64_t finish() {
+			flush();
+			return checksum.finish();
+		}
+
+	private:
+		static constexpr size_t bufferSize = 1 << 16;
+
+		std::ofstream& out;
+		std::vector<char> buffer;
+		uint64_t written;
+		objParser::ContentHash checksum;
+	};
+
+	static objParser::BinaryCacheHeader makeHeader() noexcept {
+		objParser::BinaryCacheHeader header{};
+		std::memcpy(header.magic, magic, sizeof(magic));
+		header.version = objParser::binaryCacheVersion;
+		header.indexSize = sizeof(objParser::Index);
+		header.indexSigned = std::is_signed_v<objParser::Index>;
+		header.sizeSize = sizeof(size_t);
+		header.byteOrder = byteOrder;
+		return header;
+	}
+
+	static objParser::Error checkHeader(std::string_view file, const objParser::BinaryCacheHeader& header) {
+		objParser::BinaryCacheHeader expected = makeHeader();
+
+		if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "file is not a binary cache");
+		}
+		if (header.version != expected.version) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache is version " + std::to_string(header.version) + ", expected " + std::to_string(expected.version));
+		}
+		if (header.indexSize != expected.indexSize || header.indexSigned != expected.indexSigned || header.sizeSize != expected.sizeSize || header.byteOrder != expected.byteOrder) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache was written by a build with a different index type, size_t or byte order");
+		}
+		if (header.fileSize != file.size()) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache is truncated");
+		}
+		if (!inFile<objParser::BinaryCacheMeshRecord>(file, header.meshs) || !inFile<objParser::BinaryCacheMaterialRecord>(file, header.materials) || !inFile<objParser::BinaryCacheDependencyRecord>(file, header.dependencies)) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache tables are outside the file");
+		}
+
+		return objParser::ErrorType::OK;
+	}
+}
+
+size_t objParser::CachedAttributeArrays::size() const noexcept {
+	return xs.size();
+}
+
+size_t objParser::CachedMesh::vertexCount() const noexcept {
+	return vertices.size() + vertexArrays.size();
+}
+
+size_t objParser::CachedMesh::vertexTextureCoordinateCount() const noexcept {
+	return vertexTextureCoordinates.size() + vertexTextureCoordinateArrays.size();
+}
+
+size_t objParser::CachedMesh::vertexNormalCount() const noexcept {
+	return vertexNormals.size() + vertexNormalArrays.size();
+}
+
+objParser::BinaryCache::BinaryCache() noexcept {}
+
+objParser::Error objParser::BinaryCache::open(const std::filesystem::path& fileName, const objParser::ParseOptions& options, bool verifyChecksum) {
+	close();
+
+	objParser::Error error = file.open(fileName, options);
+	if (error != objParser::ErrorType::OK) {
+		std::ostringstream errorStream;
+		errorStream << "could not map binary cache '" << fileName << "'";
+		return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+	}
+
+	std::string_view view = file.view();
+	if (view.size() < sizeof(objParser::BinaryCacheHeader)) {
+		close();
+		return objParser::Error(objParser::ErrorType::FileFormatError, "file is too small to be a binary cache");
+	}
+
+	objParser::BinaryCacheHeader header;
+	std::memcpy(&header, view.data(), sizeof(header));
+
+	error = BinaryCacheHelpers::checkHeader(view, header);
+	if (error == objParser::ErrorType::OK && verifyChecksum) {
+		objParser::ContentHash checksum;
+		checksum.update(view.data() + sizeof(header), view.size() - sizeof(header));
+
+		if (checksum.finish() != header.checksum) {
+			error = objParser::Error(objParser::ErrorType::FileFormatError, "binary cache checksum does not match, the file is damaged");
+		}
+	}
+
+	if (error != objParser::ErrorType::OK) {
+		close();
+		return error;
+	}
+
+	meshRecords = BinaryCacheHelpers::arrayAt<objParser::BinaryCacheMeshRecord>(view, header.meshs);
+	materialRecords = BinaryCacheHelpers::arrayAt<objParser::BinaryCacheMaterialRecord>(view, header.materials);
+	dependencyRecords = BinaryCacheHelpers::arrayAt<objParser::BinaryCacheDependencyRecord>(view, header.dependencies);
+
+	for (const objParser::BinaryCacheMeshRecord& record : meshRecords) {
+		bool inside = BinaryCacheHelpers::inFile<char>(view, record.name);
+
+		objParser::CachedMesh types;
+		BinaryCacheHelpers::visitArrays(record, types, [&](const objParser::BinaryCacheArray& array, auto& span) {
+			using T = typename std::remove_reference_t<decltype(span)>::element_type;
+			inside = inside && BinaryCacheHelpers::inFile<T>(view, array);
+		});
+
+		if (!inside) {
+			close();
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache mesh points outside the file");
+		}
+	}
+
+	for (const objParser::BinaryCacheMaterialRecord& record : materialRecords) {
+		if (!BinaryCacheHelpers::inFile<char>(view, record.name)) {
+			close();
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache material points outside the file");
+		}
+	}
+
+	for (const objParser::BinaryCacheDependencyRecord& record : dependencyRecords) {
+		if (!BinaryCacheHelpers::inFile<char>(view, record.path) || !BinaryCacheHelpers::inFile<char>(view, record.listedPath)) {
+			close();
+			return objParser::Error(objParser::ErrorType::FileFormatError, "binary cache dependency points outside the file");
+		}
+	}
+
+	return objParser::ErrorType::OK;
+}
+
+void objParser::BinaryCache::close() noexcept {
+	file.close();
+	meshRecords = {};
+	materialRecords = {};
+	dependencyRecords = {};
+}
+
+bool objParser::BinaryCache::isOpen() const noexcept {
+	return file.isOpen();
+}
+
+size_t objParser::BinaryCache::meshCount() const noexcept {
+	return meshRecords.size();
+}
+
+size_t objParser::BinaryCache::materialCount() const noexcept {
+	return materialRecords.size();
+}
+
+size_t objParser::BinaryCache::dependencyCount() const noexcept {
+	return dependencyRecords.size();
+}
+
+objParser::CachedMesh objParser::BinaryCache::mesh(size_t i) const noexcept {
+	std::string_view view = file.view();
+	const objParser::BinaryCacheMeshRecord& record = meshRecords[i];
+
+	objParser::CachedMesh mesh;
+	BinaryCacheHelpers::visitArrays(record, mesh, [&](const objParser::BinaryCacheArray& array, auto& span) {
+		using T = typename std::remove_reference_t<decltype(span)>::element_type;
+		span = BinaryCacheHelpers::arrayAt<T>(view, array);
+	});
+
+	std::span<const char> name = BinaryCacheHelpers::arrayAt<char>(view, record.name);
+	mesh.name = std::string_view(name.data(), name.size());
+	mesh.mtlIndex = record.mtlIndex == BinaryCacheHelpers::noMaterialRecord ? objParser::noMaterial : static_cast<size_t>(record.mtlIndex);
+
+	return mesh;
+}
+
+objParser::CachedMaterial objParser::BinaryCache::material(size_t i) const noexcept {
+	const objParser::BinaryCacheMaterialRecord& record = materialRecords[i];
+	std::span<const char> name = BinaryCacheHelpers::arrayAt<char>(file.view(), record.name);
+
+	objParser::CachedMaterial material;
+	material.name = std::string_view(name.data(), name.size());
+	material.ambientColor = record.ambientColor;
+	material.diffuseColor = record.diffuseColor;
+	material.specularColor = record.specularColor;
+	material.specularExponent = record.specularExponent;
+	material.transparent = record.transparent;
+	material.transmissionFilter = record.transmissionFilter;
+	material.indexOfRefraction = record.indexOfRefraction;
+
+	return material;
+}
+
+objParser::CacheDependency objParser::BinaryCache::dependency(size_t i) const {
+	const objParser::BinaryCacheDependencyRecord& record = dependencyRecords[i];
+	std::span<const char> path = BinaryCacheHelpers::arrayAt<char>(file.view(), record.path);
+	std::span<const char> listedPath = BinaryCacheHelpers::arrayAt<char>(file.view(), record.listedPath);
+
+	return { std::string(path.data(), path.size()), record.hash, std::string(listedPath.data(), listedPath.size()) };
+}
+
+objParser::Error objParser::saveBinaryCache(const std::filesystem::path& fileName, std::span<const objParser::Mesh> meshs, std::span<const objParser::Material> materials, std::span<const objParser::CacheDependency> dependencies) {
+	// lay the whole file out first, so the records can be written before the arrays they point to
+	objParser::BinaryCacheHeader header = BinaryCacheHelpers::makeHeader();
+	uint64_t end = sizeof(header);
+
+	auto place = [&end](objParser::BinaryCacheArray& array, uint64_t count, uint64_t elementSize) {
+		end = BinaryCacheHelpers::alignUp(end, BinaryCacheHelpers::arrayAlignment);
+		array = { end, count };
+		end += count * elementSize;
+	};
+
+	place(header.meshs, meshs.size(), sizeof(objParser::BinaryCacheMeshRecord));
+	place(header.materials, materials.size(), sizeof(objParser::BinaryCacheMaterialRecord));
+	place(header.dependencies, dependencies.size(), sizeof(objParser::BinaryCacheDependencyRecord));
+
+	std::vector<objParser::CachedMesh> views;
+	std::vector<objParser::BinaryCacheMeshRecord> meshRecords(meshs.size());
+	views.reserve(meshs.size());
+
+	for (size_t i = 0; i < meshs.size(); i++) {
+		objParser::CachedMesh& view = views.emplace_back(BinaryCacheHelpers::viewOf(meshs[i]));
+		objParser::BinaryCacheMeshRecord& record = meshRecords[i];
+
+		BinaryCacheHelpers::visitArrays(record, view, [&](objParser::BinaryCacheArray& array, auto& span) {
+			using T = typename std::remove_reference_t<decltype(span)>::element_type;
+			place(array, span.size(), sizeof(T));
+		});
+		place(record.name, view.name.size(), 1);
+		record.mtlIndex = view.mtlIndex == objParser::noMaterial ? BinaryCacheHelpers::noMaterialRecord : view.mtlIndex;
+	}
+
+	std::vector<objParser::BinaryCacheMaterialRecord> materialRecords(materials.size());
+	for (size_t i = 0; i < materials.size(); i++) {
+		const objParser::Material& material = materials[i];
+		objParser::BinaryCacheMaterialRecord& record = materialRecords[i];
+
+		place(record.name, material.name.size(), 1);
+		record.ambientColor = material.ambientColor;
+		record.diffuseColor = material.diffuseColor;
+		record.specularColor = material.specularColor;
+		record.specularExponent = material.specularExponent;
+		record.transparent = material.transparent;
+		record.transmissionFilter = material.transmissionFilter;
+		record.indexOfRefraction = material.indexOfRefraction;
+	}
+
+	std::vector<objParser::BinaryCacheDependencyRecord> dependencyRecords(dependencies.size());
+	for (size_t i = 0; i < dependencies.size(); i++) {
+		place(dependencyRecords[i].path, dependencies[i].path.size(), 1);
+		place(dependencyRecords[i].listedPath, dependencies[i].listedPath.size(), 1);
+		dependencyRecords[i].hash = dependencies[i].hash;
+	}
+
+	// the end is padded too, so every array can be read a full alignment at a time
+	header.fileSize = BinaryCacheHelpers::alignUp(end, BinaryCacheHelpers::arrayAlignment);
+
+	std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+	if (!out.is_open()) {
+		std::ostringstream errorStream;
+		errorStream << "could not open '" << fileName << "' to write the binary cache";
+		return objParser::Error(objParser::ErrorType::FileWriteError, errorStream.str());
+	}
+
+	// the header goes in last, once the checksum is known
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	BinaryCacheHelpers::CacheWriter writer(out);
+	writer.padTo(header.meshs.offset - sizeof(header));
+	writer.write(meshRecords.data(), meshRecords.size() * sizeof(objParser::BinaryCacheMeshRecord));
+	writer.padTo(header.materials.offset - sizeof(header));
+	writer.write(materialRecords.data(), materialRecords.size() * sizeof(objParser::BinaryCacheMaterialRecord));
+	writer.padTo(header.dependencies.offset - sizeof(header));
+	writer.write(dependencyRecords.data(), dependencyRecords.size() * sizeof(objParser::BinaryCacheDependencyRecord));
+
+	// the writer counts from the end of the header
+	auto writeArray = [&writer](const objParser::BinaryCacheArray& array, const void* data, size_t size) {
+		writer.padTo(array.offset - sizeof(objParser::BinaryCacheHeader));
+		writer.write(data, size);
+	};
+
+	for (size_t i = 0; i < meshs.size(); i++) {
+		BinaryCacheHelpers::visitArrays(meshRecords[i], views[i], [&](const objParser::BinaryCacheArray& array, auto& span) {
+			writeArray(array, span.data(), span.size_bytes());
+		});
+		writeArray(meshRecords[i].name, views[i].name.data(), views[i].name.size());
+	}
+
+	for (size_t i = 0; i < materials.size(); i++) {
+		writeArray(materialRecords[i].name, materials[i].name.data(), materials[i].name.size());
+	}
+
+	for (size_t i = 0; i < dependencies.size(); i++) {
+		writeArray(dependencyRecords[i].path, dependencies[i].path.data(), dependencies[i].path.size());
+		writeArray(dependencyRecords[i].listedPath, dependencies[i].listedPath.data(), dependencies[i].listedPath.size());
+	}
+
+	writer.padTo(header.fileSize - sizeof(header));
+	header.checksum = writer.finish();
+
+	out.seekp(0);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.close();
+
+	if (out.fail()) {
+		std::ostringstream errorStream;
+		errorStream << "could not write the binary cache to '" << fileName << "'";
+		return objParser::Error(objParser::ErrorType::FileWriteError, errorStream.str());
+	}
+
+	return objParser::ErrorType::OK;
+}
+
+void objParser::BinaryCache::load(objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials) const {
+	size_t materialBase = materials.size();
+
+	materials.reserve(materials.size() + materialCount());
+	for (size_t i = 0; i < materialCount(); i++) {
+		objParser::CachedMaterial cached = material(i);
+		objParser::Material& loaded = materials.emplace_back(std::string(cached.name));
+
+		loaded.ambientColor = cached.ambientColor;
+		loaded.diffuseColor = cached.diffuseColor;
+		loaded.specularColor = cached.specularColor;
+		loaded.specularExponent = cached.specularExponent;
+		loaded.transparent = cached.transparent;
+		loaded.transmissionFilter = cached.transmissionFilter;
+		loaded.indexOfRefraction = cached.indexOfRefraction;
+	}
+
+	meshs.reserve(meshs.size() + meshCount());
+	for (size_t i = 0; i < meshCount(); i++) {
+		objParser::CachedMesh cached = mesh(i);
+		objParser::Mesh& loaded = meshs.emplace_back(std::string(cached.name));
+
+		loaded.vertices.assign(cached.vertices.begin(), cached.vertices.end());
+		loaded.vertexTextureCoordinates.assign(cached.vertexTextureCoordinates.begin(), cached.vertexTextureCoordinates.end());
+		loaded.vertexNormals.assign(cached.vertexNormals.begin(), cached.vertexNormals.end());
+
+		auto assignArrays = [](objParser::AttributeArrays& arrays, const objParser::CachedAttributeArrays& cachedArrays) {
+			arrays.xs.assign(cachedArrays.xs.begin(), cachedArrays.xs.end());
+			arrays.ys.assign(cachedArrays.ys.begin(), cachedArrays.ys.end());
+			arrays.zs.assign(cachedArrays.zs.begin(), cachedArrays.zs.end());
+		};
+		assignArrays(loaded.vertexArrays, cached.vertexArrays);
+		assignArrays(loaded.vertexTextureCoordinateArrays, cached.vertexTextureCoordinateArrays);
+		assignArrays(loaded.vertexNormalArrays, cached.vertexNormalArrays);
+
+		loaded.vertexIndexes.assign(cached.vertexIndexes.begin(), cached.vertexIndexes.end());
+		loaded.vertexTextureCoordinatesIndexes.assign(cached.vertexTextureCoordinatesIndexes.begin(), cached.vertexTextureCoordinatesIndexes.end());
+		loaded.vertexNormalsIndexes.assign(cached.vertexNormalsIndexes.begin(), cached.vertexNormalsIndexes.end());
+
+		// a mesh without a usemtl has no material to offset
+		loaded.mtlIndex = cached.mtlIndex == objParser::noMaterial ? objParser::noMaterial : cached.mtlIndex + materialBase;
+		loaded.materialRanges.reserve(cached.materialRanges.size());
+		for (const objParser::MaterialRange& range : cached.materialRanges) {
+			loaded.materialRanges.push_back({ range.firstIndex, range.indexCount, range.mtlIndex + materialBase });
+		}
+	}
+}
+
+objParser::Error objParser::loadBinaryCache(const std::filesystem::path& fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	objParser::BinaryCache cache;
+	objParser::Error error = cache.open(fileName, options);
+	if (error != objParser::ErrorType::OK) {
+		return error;
+	}
+
+	cache.load(meshs, materials);
+	return objParser::ErrorType::OK;
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include "../../include/ByteScanner.hpp"
+
+#include <atomic>
+#include <bit>
+
+// sse2 is always there on x86-64, so only the wider instruction sets need checking at runtime
+#if defined(__x86_64__) || defined(_M_X64)
+	#define OBJ_PARSER_X86_SIMD
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+// gcc and clang only let a function use an instruction set if it says so, msvc lets any function use any of them
+#if defined(OBJ_PARSER_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+	#define OBJ_PARSER_TARGET(isa) __attribute__((target(isa)))
+#else
+	#define OBJ_PARSER_TARGET(isa)
+#endif
+
+namespace ByteScannerHelpers {
+	// scalar
+
+	static const char* findNewlineScalar(const char* begin, const char* end) noexcept {
+		const void* newline = std::memchr(begin, '\n', end - begin);
+		return newline != nullptr ? static_cast<const char*>(newline) : end;
+	}
+
+	static uint64_t newlineMaskScalar(const char* block) noexcept {
+		uint64_t mask = 0;
+		for (int i = 0; i < 64; i++) {
+			mask |= static_cast<uint64_t>(block[i] == '\n') << i;
+		}
+		return mask;
+	}
+
+#ifdef OBJ_PARSER_X86_SIMD
+
+	// sse2, 16 bytes at a time
+
+	static const char* findNewlineSse2(const char* begin, const char* end) noexcept {
+		const __m128i newline = _mm_set1_epi8('\n');
+
+		for (; end - begin >= 16; begin += 16) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+			uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+			if (mask != 0) {
+				return begin + std::countr_zero(mask);
+			}
+		}
+
+		return findNewlineScalar(begin, end);
+	}
+
+	static uint64_t newlineMaskSse2(const char* block) noexcept {
+		const __m128i newline = _mm_set1_epi8('\n');
+		uint64_t mask = 0;
+
+		for (int i = 0; i < 4; i++) {
+			__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+			mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)))) << (i * 16);
+		}
+
+		return mask;
+	}
+
+	// avx2, 32 bytes at a time
+
+	OBJ_PARSER_TARGET("avx2")
+	static const char* findNewlineAvx2(const char* begin, const char* end) noexcept {
+		const __m256i newline = _mm256_set1_epi8('\n');
+
+		for (; end - begin >= 32; begin += 32) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+			uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+			if (mask != 0) {
+				return begin + std::countr_zero(mask);
+			}
+		}
+
+		return findNewlineSse2(begin, end);
+	}
+
+	OBJ_PARSER_TARGET("avx2")
+	static uint64_t newlineMaskAvx2(const char* block) noexcept {
+		const __m256i newline = _mm256_set1_epi8('\n');
+
+		uint32_t low = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)), newline)));
+		uint32_t high = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32)), newline)));
+
+		return static_cast<uint64_t>(low) | (static_cast<uint64_t>(high) << 32);
+	}
+
+	// avx512bw, 64 bytes at a time
+
+	OBJ_PARSER_TARGET("avx512f,avx512bw")
+	static const char* findNewlineAvx512(const char* begin, const char* end) noexcept {
+		const __m512i newline = _mm512_set1_epi8('\n');
+
+		for (; end - begin >= 64; begin += 64) {
+			uint64_t mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(begin), newline);
+			if (mask != 0) {
+				return begin + std::countr_zero(mask);
+			}
+		}
+
+		return findNewlineAvx2(begin, end);
+	}
+
+	OBJ_PARSER_TARGET("avx512f,avx512bw")
+	static uint64_t newlineMaskAvx512(const char* block) noexcept {
+		return _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(block), _mm512_set1_epi8('\n'));
+	}
+
+	static objParser::SimdLevel detectSimdLevel() noexcept {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+
+		__cpuid(info, 1);
+		bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+		bool osSavesZmm = osSavesYmm && (_xgetbv(0) & 0xe6) == 0xe6;
+
+		if (maxLeaf >= 7) {
+			__cpuidex(info, 7, 0);
+			if (osSavesZmm && (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0) {
+				return objParser::SimdLevel::avx512;
+			}
+			if (osSavesYmm && (info[1] & (1 << 5)) != 0) {
+				return objParser::SimdLevel::avx2;
+			}
+		}
+
+		return objParser::SimdLevel::sse2;
+	#else
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+			return objParser::SimdLevel::avx512;
+		}
+		if (__builtin_cpu_supports("avx2")) {
+			return objParser::SimdLevel::avx2;
+		}
+		if (__builtin_cpu_supports("sse2")) {
+			return objParser::SimdLevel::sse2;
+		}
+
+		return objParser::SimdLevel::scalar;
+	#endif
+	}
+
+#else
+
+	static objParser::SimdLevel detectSimdLevel() noexcept {
+		return objParser::SimdLevel::scalar;
+	}
+
+#endif
+
+	struct ScannerFunctions {
+		objParser::SimdLevel level;
+		const char* (*findNewline)(const char*, const char*) noexcept;
+		uint64_t (*newlineMask)(const char*) noexcept;
+	};
+
+	static const ScannerFunctions& functionsFor(objParser::SimdLevel level) noexcept {
+#ifdef OBJ_PARSER_X86_SIMD
+		static constexpr ScannerFunctions avx512 = { objParser::SimdLevel::avx512, findNewlineAvx512, newlineMaskAvx512 };
+		static constexpr ScannerFunctions avx2 = { objParser::SimdLevel::avx2, findNewlineAvx2, newlineMaskAvx2 };
+		static constexpr ScannerFunctions sse2 = { objParser::SimdLevel::sse2, findNewlineSse2, newlineMaskSse2 };
+#endif
+		static constexpr ScannerFunctions scalar = { objParser::SimdLevel::scalar, findNewlineScalar, newlineMaskScalar };
+
+		switch (level) {
+#ifdef OBJ_PARSER_X86_SIMD
+		case objParser::SimdLevel::avx512:
+			return avx512;
+		case objParser::SimdLevel::avx2:
+			return avx2;
+		case objParser::SimdLevel::sse2:
+			return sse2;
+#endif
+		default:
+			return scalar;
+		}
+	}
+
+	static objParser::SimdLevel detectedLevel() noexcept {
+		static const objParser::SimdLevel level = detectSimdLevel();
+		return level;
+	}
+
+	// a pointer to one of the tables, so a setSimdLevel on another thread swaps every function at once
+	static std::atomic<const ScannerFunctions*>& activeTable() noexcept {
+		static std::atomic<const ScannerFunctions*> table = &functionsFor(detectedLevel());
+		return table;
+	}
+
+	static const ScannerFunctions& activeFunctions() noexcept {
+		return *activeTable().load(std::memory_order_acquire);
+	}
+}
+
+std::ostream& objParser::operator<<(std::ostream& oss, const objParser::SimdLevel& level) noexcept {
+	switch (level) {
+	case(objParser::SimdLevel::scalar):
+		oss << "scalar";
+		break;
+	case(objParser::SimdLevel::sse2):
+		oss << "sse2";
+		break;
+	case(objParser::SimdLevel::avx2):
+		oss << "avx2";
+		break;
+	case(objParser::SimdLevel::avx512):
+		oss << "avx512";
+		break;
+	default:
+		break;
+	}
+
+	return oss;
+}
+
+objParser::SimdLevel objParser::detectedSimdLevel() noexcept {
+	return ByteScannerHelpers::detectedLevel();
+}
+
+objParser::SimdLevel objParser::activeSimdLevel() noexcept {
+	return ByteScannerHelpers::activeFunctions().level;
+}
+
+objParser::SimdLevel objParser::setSimdLevel(objParser::SimdLevel level) noexcept {
+	if (level > ByteScannerHelpers::detectedLevel()) {
+		level = ByteScannerHelpers::detectedLevel();
+	}
+
+	const ByteScannerHelpers::ScannerFunctions& functions = ByteScannerHelpers::functionsFor(level);
+	ByteScannerHelpers::activeTable().store(&functions, std::memory_order_release);
+
+	return functions.level;
+}
+
+const char* objParser::findNewline(const char* begin, const char* end) noexcept {
+	return ByteScannerHelpers::activeFunctions().findNewline(begin, end);
+}
+
+objParser::LineSplitter::LineSplitter(std::string_view buffer) noexcept : lineStart(buffer.data()), blockStart(buffer.data()), end(buffer.data() + buffer.size()), newlineMask(0) {
+	loadBlock();
+}
+
+void objParser::LineSplitter::loadBlock() noexcept {
+	if (end - blockStart >= 64) {
+		newlineMask = ByteScannerHelpers::activeFunctions().newlineMask(blockStart);
+		return;
+	}
+
+	// the last block is short, so it cant be loaded all at once without reading past the end
+	newlineMask = 0;
+	for (const char* it = blockStart; it < end; it++) {
+		newlineMask |= static_cast<uint64_t>(*it == '\n') << (it - blockStart);
+	}
+}
+
+bool objParser::LineSplitter::next(std::string_view& line) noexcept {
+	while (newlineMask == 0) {
+		if (end - blockStart <= 64) {
+			// last line without a newline on the end
+			if (lineStart < end) {
+				line = std::string_view(lineStart, end - lineStart);
+				lineStart = end;
+				return true;
+			}
+
+			return false;
+		}
+
+		blockStart += 64;
+		loadBlock();
+	}
+
+	const char* newline = blockStart + std::countr_zero(newlineMask);
+	newlineMask &= newlineMask - 1;
+
+	line = std::string_view(lineStart, newline - lineStart);
+	lineStart = newline + 1;
+
+	return true;
+}
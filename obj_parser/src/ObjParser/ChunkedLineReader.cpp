@@ -0,0 +1,61 @@
+#include "../../include/ChunkedLineReader.hpp"
+#include "../../include/ByteScanner.hpp"
+
+objParser::ChunkedLineReader::ChunkedLineReader(std::istream& stream, size_t chunkSize, std::pmr::memory_resource* resource) : stream(stream), buffer(chunkSize > 0 ? chunkSize : 1, resource), lineStart(0), scanStart(0), dataEnd(0), streamDone(false) {}
+
+bool objParser::ChunkedLineReader::refill() {
+	// move the unfinished line to the front so the rest of the buffer can be filled
+	if (lineStart > 0) {
+		std::memmove(buffer.data(), buffer.data() + lineStart, dataEnd - lineStart);
+		scanStart -= lineStart;
+		dataEnd -= lineStart;
+		lineStart = 0;
+	}
+
+	// the line is longer than the whole buffer, this should basically never happen
+	if (dataEnd == buffer.size()) {
+		buffer.resize(buffer.size() * 2);
+	}
+
+	stream.read(buffer.data() + dataEnd, buffer.size() - dataEnd);
+	size_t bytesRead = static_cast<size_t>(stream.gcount());
+	dataEnd += bytesRead;
+
+	if (bytesRead == 0 || !stream) {
+		streamDone = true;
+	}
+
+	return bytesRead > 0;
+}
+
+bool objParser::ChunkedLineReader::nextLine(std::string_view& line) {
+	while (true) {
+		const char* dataEndPointer = buffer.data() + dataEnd;
+		const char* newline = objParser::findNewline(buffer.data() + scanStart, dataEndPointer);
+
+		if (newline != dataEndPointer) {
+			size_t lineEnd = newline - buffer.data();
+			line = std::string_view(buffer.data() + lineStart, lineEnd - lineStart);
+
+			lineStart = lineEnd + 1;
+			scanStart = lineStart;
+			return true;
+		}
+
+		scanStart = dataEnd;
+
+		if (streamDone) {
+			// last line without a newline on the end
+			if (lineStart < dataEnd) {
+				line = std::string_view(buffer.data() + lineStart, dataEnd - lineStart);
+				lineStart = dataEnd;
+				scanStart = dataEnd;
+				return true;
+			}
+
+			return false;
+		}
+
+		refill();
+	}
+}
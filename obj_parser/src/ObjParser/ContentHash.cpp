@@ -0,0 +1,128 @@
+#include "../../include/ContentHash.hpp"
+
+#include <bit>
+
+namespace ContentHashHelpers {
+	constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+	constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+	constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+	constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+	constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+	// always little endian, so a hash means the same thing on every machine
+	static inline uint64_t readWord(const unsigned char* bytes) noexcept {
+		uint64_t word;
+		std::memcpy(&word, bytes, sizeof(word));
+		if constexpr (std::endian::native == std::endian::big) {
+			word = std::byteswap(word);
+		}
+		return word;
+	}
+
+	static inline uint64_t round(uint64_t lane, uint64_t word) noexcept {
+		lane += word * prime2;
+		lane = std::rotl(lane, 31);
+		return lane * prime1;
+	}
+
+	static inline uint64_t mergeLane(uint64_t hash, uint64_t lane) noexcept {
+		hash ^= round(0, lane);
+		return hash * prime1 + prime4;
+	}
+
+	// hashFile reads through a buffer this big
+	constexpr size_t readSize = 1 << 16;
+}
+
+objParser::ContentHash::ContentHash() noexcept :
+	lanes{ ContentHashHelpers::prime1 + ContentHashHelpers::prime2, ContentHashHelpers::prime2, 0, 0 - ContentHashHelpers::prime1 },
+	pending{},
+	pendingBytes(0),
+	length(0) {}
+
+void objParser::ContentHash::stripe(const unsigned char* bytes) noexcept {
+	// the lanes dont depend on each other, so the four multiplies can all be in flight at once
+	lanes[0] = ContentHashHelpers::round(lanes[0], ContentHashHelpers::readWord(bytes));
+	lanes[1] = ContentHashHelpers::round(lanes[1], ContentHashHelpers::readWord(bytes + 8));
+	lanes[2] = ContentHashHelpers::round(lanes[2], ContentHashHelpers::readWord(bytes + 16));
+	lanes[3] = ContentHashHelpers::round(lanes[3], ContentHashHelpers::readWord(bytes + 24));
+}
+
+void objParser::ContentHash::update(const void* data, size_t size) noexcept {
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	length += size;
+
+	if (pendingBytes != 0) {
+		size_t taken = std::min(size, stripeSize - pendingBytes);
+		std::memcpy(pending + pendingBytes, bytes, taken);
+		pendingBytes += taken;
+		bytes += taken;
+		size -= taken;
+
+		if (pendingBytes < stripeSize) {
+			return;
+		}
+
+		stripe(pending);
+		pendingBytes = 0;
+	}
+
+	for (; size >= stripeSize; bytes += stripeSize, size -= stripeSize) {
+		stripe(bytes);
+	}
+
+	std::memcpy(pending, bytes, size);
+	pendingBytes = size;
+}
+
+uint64_t objParser::ContentHash::finish() const noexcept {
+	uint64_t hash;
+	if (length >= stripeSize) {
+		hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+		for (uint64_t lane : lanes) {
+			hash = ContentHashHelpers::mergeLane(hash, lane);
+		}
+	} else {
+		hash = ContentHashHelpers::prime5;
+	}
+	hash += length;
+
+	// whatever didnt fill a stripe, a word at a time and then a byte at a time
+	size_t i = 0;
+	for (; i + 8 <= pendingBytes; i += 8) {
+		hash ^= ContentHashHelpers::round(0, ContentHashHelpers::readWord(pending + i));
+		hash = std::rotl(hash, 27) * ContentHashHelpers::prime1 + ContentHashHelpers::prime4;
+	}
+	for (; i < pendingBytes; i++) {
+		hash ^= pending[i] * ContentHashHelpers::prime5;
+		hash = std::rotl(hash, 11) * ContentHashHelpers::prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= ContentHashHelpers::prime2;
+	hash ^= hash >> 29;
+	hash *= ContentHashHelpers::prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+objParser::Error objParser::hashFile(const std::filesystem::path& fileName, uint64_t& hash) {
+	std::ifstream inFS(fileName, std::ios::binary);
+
+	if (!inFS.is_open()) {
+		std::ostringstream errorStream;
+		errorStream << "could not find file '" << fileName << "'";
+		return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+	}
+
+	objParser::ContentHash contentHash;
+	std::vector<char> buffer(ContentHashHelpers::readSize);
+
+	while (inFS) {
+		inFS.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		contentHash.update(buffer.data(), static_cast<size_t>(inFS.gcount()));
+	}
+
+	hash = contentHash.finish();
+	return objParser::ErrorType::OK;
+}
\ No newline at end of file
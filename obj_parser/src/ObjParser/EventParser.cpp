@@ -0,0 +1,240 @@
+#include "../../include/EventParser.hpp"
+
+namespace EventParserHelpers {
+	// an index in the middle of an element has to take up all the text between the slashes
+	static bool readIndex(std::string_view text, int64_t& index) noexcept {
+		objParser::LineTokenizer indexTokens(text);
+		return indexTokens.next(index) && indexTokens.atEnd();
+	}
+
+	// the last index in an element only has to start with a number, anything after it is ignored like the old stream parse did
+	static bool readLastIndex(std::string_view text, int64_t& index) noexcept {
+		objParser::LineTokenizer indexTokens(text);
+		return indexTokens.next(index);
+	}
+
+	static const char* faceFormatError(objParser::FaceFormat format) noexcept {
+		switch (format) {
+		case objParser::FaceFormat::v:
+			return "Error reading face, format: v";
+		case objParser::FaceFormat::vvt:
+			return "Error reading face, format: v/vt";
+		case objParser::FaceFormat::vvn:
+			return "Error reading face, format: v//vn";
+		default:
+			return "Error reading face, format: v/vt/vn";
+		}
+	}
+}
+
+objParser::ObjKeyword objParser::classifyKeyword(std::string_view keyword) noexcept {
+	// new statements get their own case, so they never add a compare to the v and f lines
+	if (keyword.empty()) {
+		return objParser::ObjKeyword::empty;
+	}
+
+	switch (keyword[0]) {
+	case 'v':
+		if (keyword.size() == 1) {
+			return objParser::ObjKeyword::vertex;
+		}
+		if (keyword.size() == 2) {
+			switch (keyword[1]) {
+			case 'n':
+				return objParser::ObjKeyword::vertexNormal;
+			case 't':
+				return objParser::ObjKeyword::vertexTexture;
+			default:
+				return objParser::ObjKeyword::unknown;
+			}
+		}
+		return objParser::ObjKeyword::unknown;
+
+	case 'f':
+		return keyword.size() == 1 ? objParser::ObjKeyword::face : objParser::ObjKeyword::unknown;
+
+	case 'o':
+		return keyword.size() == 1 ? objParser::ObjKeyword::object : objParser::ObjKeyword::unknown;
+
+	case '#':
+		return keyword.size() == 1 ? objParser::ObjKeyword::comment : objParser::ObjKeyword::unknown;
+
+	case 'u':
+		return keyword == "usemtl" ? objParser::ObjKeyword::useMaterial : objParser::ObjKeyword::unknown;
+
+	case 'm':
+		return keyword == "mtllib" ? objParser::ObjKeyword::materialLibrary : objParser::ObjKeyword::unknown;
+
+	default:
+		return objParser::ObjKeyword::unknown;
+	}
+}
+
+bool objParser::decodeFaceCorner(std::string_view text, objParser::FaceCorner& corner) noexcept {
+	size_t firstSlashIndex = text.find('/');
+
+	if (firstSlashIndex == std::string_view::npos) {
+		// v
+		corner.format = objParser::FaceFormat::v;
+		return EventParserHelpers::readLastIndex(text, corner.v) && corner.v != 0;
+	}
+
+	size_t secondSlashIndex = text.rfind('/');
+
+	if (firstSlashIndex == secondSlashIndex) {
+		// v/vt
+		corner.format = objParser::FaceFormat::vvt;
+		return EventParserHelpers::readIndex(text.substr(0, firstSlashIndex), corner.v) && EventParserHelpers::readLastIndex(text.substr(firstSlashIndex + 1), corner.vt) && corner.v != 0 && corner.vt != 0;
+	}
+
+	if (firstSlashIndex == secondSlashIndex - 1) {
+		// v//vn
+		corner.format = objParser::FaceFormat::vvn;
+		return EventParserHelpers::readIndex(text.substr(0, firstSlashIndex), corner.v) && EventParserHelpers::readLastIndex(text.substr(secondSlashIndex + 1), corner.vn) && corner.v != 0 && corner.vn != 0;
+	}
+
+	// v/vt/vn
+	corner.format = objParser::FaceFormat::vvtvn;
+	return EventParserHelpers::readIndex(text.substr(0, firstSlashIndex), corner.v) && EventParserHelpers::readIndex(text.substr(firstSlashIndex + 1, secondSlashIndex - firstSlashIndex - 1), corner.vt) && EventParserHelpers::readLastIndex(text.substr(secondSlashIndex + 1), corner.vn) && corner.v != 0 && corner.vt != 0 && corner.vn != 0;
+}
+
+bool objParser::resolveFaceIndex(int64_t& index, size_t count) noexcept {
+	if (index < 0) {
+		index = static_cast<int64_t>(count) + index;
+	} else {
+		index -= 1;
+	}
+
+	return index >= 0 && index < static_cast<int64_t>(count);
+}
+
+objParser::FaceCorners::FaceCorners() noexcept : count(0), cornerFormat(objParser::FaceFormat::notSet) {}
+
+size_t objParser::FaceCorners::size() const noexcept {
+	return count;
+}
+
+objParser::FaceFormat objParser::FaceCorners::format() const noexcept {
+	return cornerFormat;
+}
+
+bool objParser::FaceCorners::hasTextureCoordinates() const noexcept {
+	return cornerFormat == objParser::FaceFormat::vvt || cornerFormat == objParser::FaceFormat::vvtvn;
+}
+
+bool objParser::FaceCorners::hasNormals() const noexcept {
+	return cornerFormat == objParser::FaceFormat::vvn || cornerFormat == objParser::FaceFormat::vvtvn;
+}
+
+objParser::FaceCorners::Iterator objParser::FaceCorners::begin() const noexcept {
+	return Iterator(this, 0);
+}
+
+objParser::FaceCorners::Iterator objParser::FaceCorners::end() const noexcept {
+	return Iterator(this, count);
+}
+
+objParser::Error objParser::FaceCorners::read(objParser::LineTokenizer& lineTokens) {
+	// f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3 ...
+	std::array<std::string_view, 3> texts;
+
+	if (!(lineTokens.next(texts[0]) && lineTokens.next(texts[1]) && lineTokens.next(texts[2]))) {
+		return objParser::Error(objParser::ErrorType::FileFormatError, "Must be exactly 3 verts");
+	}
+
+	count = 0;
+	cornerFormat = objParser::FaceFormat::notSet;
+
+	auto addCorner = [this](std::string_view text) -> objParser::Error {
+		objParser::FaceCorner decoded;
+		objParser::FaceCorner& corner = count < inlineCorners ? first[count] : decoded;
+		corner = {};
+		count++;
+
+		if (!objParser::decodeFaceCorner(text, corner)) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, EventParserHelpers::faceFormatError(corner.format));
+		}
+
+		if (cornerFormat == objParser::FaceFormat::notSet) {
+			cornerFormat = corner.format;
+		} else if (cornerFormat != corner.format) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, must be all the same type of input (for example, all v//vn)");
+		}
+
+		return objParser::ErrorType::OK;
+	};
+
+	for (std::string_view text : texts) {
+		objParser::Error error = addCorner(text);
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+	}
+
+	std::string_view text;
+	while (lineTokens.next(text)) {
+		objParser::Error error = addCorner(text);
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+
+		if (count == inlineCorners) {
+			rest = lineTokens;
+		}
+	}
+
+	return objParser::ErrorType::OK;
+}
+
+objParser::FaceCorners::Iterator::Iterator() noexcept : corners(nullptr), index(0) {}
+
+objParser::FaceCorners::Iterator::Iterator(const objParser::FaceCorners* corners, size_t index) noexcept : corners(corners), index(index), rest(corners->rest) {}
+
+const objParser::FaceCorner& objParser::FaceCorners::Iterator::operator*() const noexcept {
+	return index < inlineCorners ? corners->first[index] : current;
+}
+
+const objParser::FaceCorner* objParser::FaceCorners::Iterator::operator->() const noexcept {
+	return &**this;
+}
+
+objParser::FaceCorners::Iterator& objParser::FaceCorners::Iterator::operator++() noexcept {
+	index++;
+
+	// read already checked every corner, so this cant fail
+	if (index >= inlineCorners && index < corners->count) {
+		std::string_view text;
+		rest.next(text);
+		current = {};
+		objParser::decodeFaceCorner(text, current);
+	}
+
+	return *this;
+}
+
+objParser::FaceCorners::Iterator objParser::FaceCorners::Iterator::operator++(int) noexcept {
+	Iterator before = *this;
+	++*this;
+	return before;
+}
+
+bool objParser::FaceCorners::Iterator::operator==(const objParser::FaceCorners::Iterator& other) const noexcept {
+	return index == other.index;
+}
+
+objParser::Error objParser::unexpectedLineStart(std::string_view keyword) {
+	std::ostringstream oss;
+	oss << "Unexpected Line start '" << keyword << "'" << std::endl;
+	return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+}
+
+objParser::Error objParser::attributeReadError(objParser::ObjKeyword keyword) {
+	switch (keyword) {
+	case objParser::ObjKeyword::vertexNormal:
+		return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in a vertex normal failed");
+	case objParser::ObjKeyword::vertexTexture:
+		return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in vertex texture (uv) coords failed");
+	default:
+		return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in a vertex failed");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "../../include/LineTokenizer.hpp"
+
+#include <charconv>
+#include <cstdint>
+
+namespace LineTokenizerHelpers {
+	// matches std::isspace in the "C" locale
+	static inline bool isWhitespace(char c) noexcept {
+		return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+	}
+
+	static inline bool isDigit(char c) noexcept {
+		return c >= '0' && c <= '9';
+	}
+
+	// powers of ten that are exact as floats
+	static constexpr float exactPowersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+	// reads the longest thing that looks like a float, the same characters operator>> would have taken
+	// rounding matches strtof exactly, but the decimal point is always '.' no matter what the global locale is
+	static const char* parseFloat(const char* begin, const char* end, float& value) noexcept {
+		const char* it = begin;
+
+		bool negative = false;
+		if (it != end && (*it == '+' || *it == '-')) {
+			negative = *it == '-';
+			it++;
+		}
+
+		// collect the significant digits as an integer, along with the power of ten they need to be scaled by
+		uint64_t mantissa = 0;
+		int significantDigits = 0;
+		int droppedDigits = 0;
+		int exponent = 0;
+		bool hasDigits = false;
+
+		while (it != end && isDigit(*it)) {
+			if (significantDigits < 19) {
+				mantissa = mantissa * 10 + (*it - '0');
+				significantDigits += (mantissa != 0);
+			} else {
+				droppedDigits++;
+			}
+			it++;
+			hasDigits = true;
+		}
+		exponent += droppedDigits;
+
+		if (it != end && *it == '.') {
+			it++;
+			while (it != end && isDigit(*it)) {
+				if (significantDigits < 19) {
+					mantissa = mantissa * 10 + (*it - '0');
+					significantDigits += (mantissa != 0);
+					exponent--;
+				} else {
+					droppedDigits++;
+				}
+				it++;
+				hasDigits = true;
+			}
+		}
+
+		if (!hasDigits) {
+			return begin;
+		}
+
+		// operator>> takes the e and its sign before it knows if digits follow, so "1e" or "1e+" is a failed read and not a 1
+		if (it != end && (*it == 'e' || *it == 'E')) {
+			it++;
+			bool negativeExponent = false;
+			if (it != end && (*it == '+' || *it == '-')) {
+				negativeExponent = *it == '-';
+				it++;
+			}
+			if (it == end || !isDigit(*it)) {
+				return begin;
+			}
+
+			int explicitExponent = 0;
+			while (it != end && isDigit(*it)) {
+				// anything this big is out of range anyway, just stop it overflowing
+				if (explicitExponent < 100000) {
+					explicitExponent = explicitExponent * 10 + (*it - '0');
+				}
+				it++;
+			}
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+		}
+
+		if (mantissa == 0) {
+			value = negative ? -0.0f : 0.0f;
+			return it;
+		}
+
+		// if the mantissa and the power of ten are both exact floats, one multiply or divide is correctly rounded
+		// this covers almost every number an exporter writes
+		if (droppedDigits == 0 && mantissa <= (uint64_t(1) << 24) && exponent >= -10 && exponent <= 10) {
+			float result = static_cast<float>(mantissa);
+			if (exponent < 0) {
+				result /= exactPowersOfTen[-exponent];
+			} else {
+				result *= exactPowersOfTen[exponent];
+			}
+
+			value = negative ? -result : result;
+			return it;
+		}
+
+		// from_chars doesnt take a leading '+'
+		const char* numberStart = (*begin == '+') ? begin + 1 : begin;
+
+		float parsed = 0.0f;
+		std::from_chars_result result = std::from_chars(numberStart, it, parsed, std::chars_format::general);
+
+		if (result.ec == std::errc::result_out_of_range) {
+			// operator>> let numbers too small for a float through as zero, only too big ones fail
+			// the decimal exponent of the leading digit says which way it went
+			if (significantDigits + exponent - 1 < 0) {
+				value = negative ? -0.0f : 0.0f;
+				return it;
+			}
+			return begin;
+		}
+
+		if (result.ec != std::errc() || result.ptr != it) {
+			return begin;
+		}
+
+		value = parsed;
+		return it;
+	}
+
+	// reads an optionally signed integer, fails if it doesnt fit in the type
+	template <typename Integer>
+	static const char* parseInt(const char* begin, const char* end, Integer& value) noexcept {
+		// from_chars doesnt take a leading '+'
+		const char* numberStart = (begin != end && *begin == '+') ? begin + 1 : begin;
+
+		if (numberStart != end && *numberStart == '-' && begin != numberStart) {
+			return begin;
+		}
+
+		Integer parsed = 0;
+		std::from_chars_result result = std::from_chars(numberStart, end, parsed);
+
+		if (result.ec != std::errc()) {
+			return begin;
+		}
+
+		value = parsed;
+		return result.ptr;
+	}
+}
+
+objParser::LineTokenizer::LineTokenizer() noexcept : cursor(nullptr), end(nullptr), failed(false) {}
+
+objParser::LineTokenizer::LineTokenizer(std::string_view line) noexcept {
+	reset(line);
+}
+
+void objParser::LineTokenizer::reset(std::string_view line) noexcept {
+	cursor = line.data();
+	end = line.data() + line.size();
+	failed = false;
+}
+
+bool objParser::LineTokenizer::skipWhitespace() noexcept {
+	while (cursor != end && LineTokenizerHelpers::isWhitespace(*cursor)) {
+		cursor++;
+	}
+
+	return cursor != end;
+}
+
+bool objParser::LineTokenizer::next(std::string_view& token) noexcept {
+	if (failed || !skipWhitespace()) {
+		failed = true;
+		return false;
+	}
+
+	const char* tokenStart = cursor;
+	while (cursor != end && !LineTokenizerHelpers::isWhitespace(*cursor)) {
+		cursor++;
+	}
+
+	token = std::string_view(tokenStart, cursor - tokenStart);
+	return true;
+}
+
+bool objParser::LineTokenizer::next(float& value) noexcept {
+	if (failed || !skipWhitespace()) {
+		failed = true;
+		return false;
+	}
+
+	const char* numberEnd = LineTokenizerHelpers::parseFloat(cursor, end, value);
+	if (numberEnd == cursor) {
+		failed = true;
+		return false;
+	}
+
+	cursor = numberEnd;
+	return true;
+}
+
+bool objParser::LineTokenizer::next(int& value) noexcept {
+	if (failed || !skipWhitespace()) {
+		failed = true;
+		return false;
+	}
+
+	const char* numberEnd = LineTokenizerHelpers::parseInt(cursor, end, value);
+	if (numberEnd == cursor) {
+		failed = true;
+		return false;
+	}
+
+	cursor = numberEnd;
+	return true;
+}
+
+bool objParser::LineTokenizer::next(int64_t& value) noexcept {
+	if (failed || !skipWhitespace()) {
+		failed = true;
+		return false;
+	}
+
+	const char* numberEnd = LineTokenizerHelpers::parseInt(cursor, end, value);
+	if (numberEnd == cursor) {
+		failed = true;
+		return false;
+	}
+
+	cursor = numberEnd;
+	return true;
+}
+
+bool objParser::LineTokenizer::fail() const noexcept {
+	return failed;
+}
+
+bool objParser::LineTokenizer::atEnd() noexcept {
+	return !skipWhitespace();
+}
@@ -0,0 +1,193 @@
+#include "../../include/MappedFile.hpp"
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+objParser::MappedFile::MappedFile() noexcept : mappedData(nullptr), mappedSize(0), opened(false), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {}
+#else
+objParser::MappedFile::MappedFile() noexcept : mappedData(nullptr), mappedSize(0), opened(false) {}
+#endif
+
+objParser::MappedFile::~MappedFile() {
+	close();
+}
+
+objParser::MappedFile::MappedFile(objParser::MappedFile&& other) noexcept : MappedFile() {
+	*this = std::move(other);
+}
+
+objParser::MappedFile& objParser::MappedFile::operator=(objParser::MappedFile&& other) noexcept {
+	if (this != &other) {
+		close();
+
+		std::swap(mappedData, other.mappedData);
+		std::swap(mappedSize, other.mappedSize);
+		std::swap(opened, other.opened);
+#ifdef _WIN32
+		std::swap(fileHandle, other.fileHandle);
+		std::swap(mappingHandle, other.mappingHandle);
+#endif
+	}
+
+	return *this;
+}
+
+bool objParser::MappedFile::isOpen() const noexcept {
+	return opened;
+}
+
+std::string_view objParser::MappedFile::view() const noexcept {
+	return std::string_view(mappedData, mappedSize);
+}
+
+#ifdef _WIN32
+
+objParser::Error objParser::MappedFile::open(const std::filesystem::path& fileName, const objParser::ParseOptions& options) {
+	close();
+
+	HANDLE file = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not open file for mapping");
+	}
+
+	if (GetFileType(file) != FILE_TYPE_DISK) {
+		CloseHandle(file);
+		return objParser::Error(objParser::ErrorType::FileNotFound, "file is not a regular file, it cant be mapped");
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not get the size of the file");
+	}
+
+	// windows refuses to map empty files, but an empty view is still a valid file
+	if (fileSize.QuadPart == 0) {
+		fileHandle = file;
+		opened = true;
+		return objParser::ErrorType::OK;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not map file");
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not map file");
+	}
+
+	if (options.prefault) {
+		WIN32_MEMORY_RANGE_ENTRY range{ view, static_cast<SIZE_T>(fileSize.QuadPart) };
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	mappedData = static_cast<const char*>(view);
+	mappedSize = static_cast<size_t>(fileSize.QuadPart);
+	opened = true;
+
+	return objParser::ErrorType::OK;
+}
+
+void objParser::MappedFile::close() noexcept {
+	if (mappedData != nullptr) {
+		UnmapViewOfFile(mappedData);
+	}
+	if (mappingHandle != nullptr) {
+		CloseHandle(mappingHandle);
+	}
+	if (fileHandle != INVALID_HANDLE_VALUE) {
+		CloseHandle(fileHandle);
+	}
+
+	mappedData = nullptr;
+	mappedSize = 0;
+	opened = false;
+	fileHandle = INVALID_HANDLE_VALUE;
+	mappingHandle = nullptr;
+}
+
+#else
+
+objParser::Error objParser::MappedFile::open(const std::filesystem::path& fileName, const objParser::ParseOptions& options) {
+	close();
+
+	int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not open file for mapping");
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+		::close(fd);
+		return objParser::Error(objParser::ErrorType::FileNotFound, "file is not a regular file, it cant be mapped");
+	}
+
+	// mmap refuses zero length mappings, but an empty view is still a valid file
+	if (fileStat.st_size == 0) {
+		::close(fd);
+		opened = true;
+		return objParser::ErrorType::OK;
+	}
+
+	int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+	if (options.prefault) {
+		flags |= MAP_POPULATE;
+	}
+#endif
+
+	void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, flags, fd, 0);
+
+	// the mapping keeps its own reference to the file
+	::close(fd);
+
+	if (view == MAP_FAILED) {
+		return objParser::Error(objParser::ErrorType::FileNotFound, "could not map file");
+	}
+
+	// these are only hints, so failing them is fine
+	madvise(view, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+	if (options.hugePages) {
+		madvise(view, static_cast<size_t>(fileStat.st_size), MADV_HUGEPAGE);
+	}
+#endif
+
+	mappedData = static_cast<const char*>(view);
+	mappedSize = static_cast<size_t>(fileStat.st_size);
+	opened = true;
+
+	return objParser::ErrorType::OK;
+}
+
+void objParser::MappedFile::close() noexcept {
+	if (mappedData != nullptr) {
+		munmap(const_cast<char*>(mappedData), mappedSize);
+	}
+
+	mappedData = nullptr;
+	mappedSize = 0;
+	opened = false;
+}
+
+#endif
@@ -1,3 +1,41 @@
 #include "../../include/Material.hpp"
 
-objParser::Material::Material(const std::string& name) : name(name) {} 
\ No newline at end of file
+#ifdef OBJ_PARSER_PMR
+
+objParser::Material::Material(std::string_view name, const allocator_type& allocator) : name(name, allocator) {}
+
+objParser::Material::Material(const objParser::Material& other, const allocator_type& allocator) :
+	name(other.name, allocator),
+	ambientColor(other.ambientColor),
+	diffuseColor(other.diffuseColor),
+	specularColor(other.specularColor),
+	specularExponent(other.specularExponent),
+	transparent(other.transparent),
+	transmissionFilter(other.transmissionFilter),
+	indexOfRefraction(other.indexOfRefraction) {}
+
+objParser::Material::Material(objParser::Material&& other, const allocator_type& allocator) :
+	name(std::move(other.name), allocator),
+	ambientColor(other.ambientColor),
+	diffuseColor(other.diffuseColor),
+	specularColor(other.specularColor),
+	specularExponent(other.specularExponent),
+	transparent(other.transparent),
+	transmissionFilter(other.transmissionFilter),
+	indexOfRefraction(other.indexOfRefraction) {}
+
+#else
+
+objParser::Material::Material(const std::string& name) : name(name) {}
+
+#endif
+
+size_t objParser::MaterialNameHash::operator()(std::string_view name) const noexcept {
+	return std::hash<std::string_view>()(name);
+}
+
+void objParser::indexMaterials(std::span<const objParser::Material> materials, objParser::MaterialIndexes& indexes, size_t first) {
+	for (size_t i = first; i < materials.size(); i++) {
+		indexes.try_emplace(materials[i].name, i);
+	}
+}
\ No newline at end of file
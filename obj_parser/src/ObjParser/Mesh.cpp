@@ -1,3 +1,119 @@
 #include "../../include/Mesh.hpp"
 
-objParser::Mesh::Mesh(std::string name) : name(name) {}
\ No newline at end of file
+#ifdef OBJ_PARSER_PMR
+
+objParser::Mesh::Mesh(std::string_view name, const allocator_type& allocator) :
+	vertices(allocator),
+	vertexTextureCoordinates(allocator),
+	vertexNormals(allocator),
+	vertexArrays(allocator),
+	vertexTextureCoordinateArrays(allocator),
+	vertexNormalArrays(allocator),
+	vertexIndexes(allocator),
+	vertexTextureCoordinatesIndexes(allocator),
+	vertexNormalsIndexes(allocator),
+	name(name, allocator),
+	materialRanges(allocator) {}
+
+objParser::Mesh::Mesh(const objParser::Mesh& other, const allocator_type& allocator) :
+	vertices(other.vertices, allocator),
+	vertexTextureCoordinates(other.vertexTextureCoordinates, allocator),
+	vertexNormals(other.vertexNormals, allocator),
+	vertexArrays(other.vertexArrays, allocator),
+	vertexTextureCoordinateArrays(other.vertexTextureCoordinateArrays, allocator),
+	vertexNormalArrays(other.vertexNormalArrays, allocator),
+	vertexIndexes(other.vertexIndexes, allocator),
+	vertexTextureCoordinatesIndexes(other.vertexTextureCoordinatesIndexes, allocator),
+	vertexNormalsIndexes(other.vertexNormalsIndexes, allocator),
+	mtlIndex(other.mtlIndex),
+	name(other.name, allocator),
+	materialRanges(other.materialRanges, allocator) {}
+
+// only actually moves when other is in the same resource, otherwise it has to copy
+objParser::Mesh::Mesh(objParser::Mesh&& other, const allocator_type& allocator) :
+	vertices(std::move(other.vertices), allocator),
+	vertexTextureCoordinates(std::move(other.vertexTextureCoordinates), allocator),
+	vertexNormals(std::move(other.vertexNormals), allocator),
+	vertexArrays(std::move(other.vertexArrays), allocator),
+	vertexTextureCoordinateArrays(std::move(other.vertexTextureCoordinateArrays), allocator),
+	vertexNormalArrays(std::move(other.vertexNormalArrays), allocator),
+	vertexIndexes(std::move(other.vertexIndexes), allocator),
+	vertexTextureCoordinatesIndexes(std::move(other.vertexTextureCoordinatesIndexes), allocator),
+	vertexNormalsIndexes(std::move(other.vertexNormalsIndexes), allocator),
+	mtlIndex(other.mtlIndex),
+	name(std::move(other.name), allocator),
+	materialRanges(std::move(other.materialRanges), allocator) {}
+
+objParser::AttributeArrays::AttributeArrays(const allocator_type& allocator) : xs(allocator), ys(allocator), zs(allocator) {}
+
+objParser::AttributeArrays::AttributeArrays(const objParser::AttributeArrays& other, const allocator_type& allocator) : xs(other.xs, allocator), ys(other.ys, allocator), zs(other.zs, allocator) {}
+
+objParser::AttributeArrays::AttributeArrays(objParser::AttributeArrays&& other, const allocator_type& allocator) : xs(std::move(other.xs), allocator), ys(std::move(other.ys), allocator), zs(std::move(other.zs), allocator) {}
+
+#else
+
+objParser::Mesh::Mesh(std::string name) : name(name) {}
+
+#endif
+
+size_t objParser::Mesh::vertexCount() const noexcept {
+	return vertices.size() + vertexArrays.size();
+}
+
+size_t objParser::Mesh::vertexTextureCoordinateCount() const noexcept {
+	return vertexTextureCoordinates.size() + vertexTextureCoordinateArrays.size();
+}
+
+size_t objParser::Mesh::vertexNormalCount() const noexcept {
+	return vertexNormals.size() + vertexNormalArrays.size();
+}
+
+std::span<const float> objParser::AttributeArrays::x() const noexcept {
+	return xs;
+}
+
+std::span<const float> objParser::AttributeArrays::y() const noexcept {
+	return ys;
+}
+
+std::span<const float> objParser::AttributeArrays::z() const noexcept {
+	return zs;
+}
+
+std::span<float> objParser::AttributeArrays::x() noexcept {
+	return xs;
+}
+
+std::span<float> objParser::AttributeArrays::y() noexcept {
+	return ys;
+}
+
+std::span<float> objParser::AttributeArrays::z() noexcept {
+	return zs;
+}
+
+size_t objParser::AttributeArrays::size() const noexcept {
+	return xs.size();
+}
+
+bool objParser::AttributeArrays::empty() const noexcept {
+	return xs.empty();
+}
+
+void objParser::AttributeArrays::push_back(float x, float y, float z) {
+	xs.push_back(x);
+	ys.push_back(y);
+	zs.push_back(z);
+}
+
+void objParser::AttributeArrays::reserve(size_t size) {
+	xs.reserve(size);
+	ys.reserve(size);
+	zs.reserve(size);
+}
+
+void objParser::AttributeArrays::append(const objParser::AttributeArrays& other) {
+	xs.insert(xs.end(), other.xs.begin(), other.xs.end());
+	ys.insert(ys.end(), other.ys.begin(), other.ys.end());
+	zs.insert(zs.end(), other.zs.begin(), other.zs.end());
+}
\ No newline at end of file
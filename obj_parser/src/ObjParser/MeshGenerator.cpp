@@ -0,0 +1,103 @@
+#include "../../include/MeshGenerator.hpp"
+
+#include <utility>
+
+objParser::MeshGenerator objParser::MeshGenerator::promise_type::get_return_object() noexcept {
+	return objParser::MeshGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+std::suspend_always objParser::MeshGenerator::promise_type::initial_suspend() const noexcept {
+	return {};
+}
+
+std::suspend_always objParser::MeshGenerator::promise_type::final_suspend() const noexcept {
+	return {};
+}
+
+std::suspend_always objParser::MeshGenerator::promise_type::yield_value(objParser::Mesh&& mesh) noexcept {
+	current = &mesh;
+	return {};
+}
+
+void objParser::MeshGenerator::promise_type::return_value(objParser::Error error) noexcept {
+	current = nullptr;
+	this->error = std::move(error);
+}
+
+void objParser::MeshGenerator::promise_type::unhandled_exception() noexcept {
+	current = nullptr;
+	exception = std::current_exception();
+}
+
+objParser::MeshGenerator::Iterator::Iterator() noexcept : handle(nullptr) {}
+
+objParser::MeshGenerator::Iterator::Iterator(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+objParser::Mesh& objParser::MeshGenerator::Iterator::operator*() const noexcept {
+	return *handle.promise().current;
+}
+
+objParser::Mesh* objParser::MeshGenerator::Iterator::operator->() const noexcept {
+	return handle.promise().current;
+}
+
+objParser::MeshGenerator::Iterator& objParser::MeshGenerator::Iterator::operator++() {
+	handle.resume();
+
+	if (handle.promise().exception) {
+		std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+	}
+
+	return *this;
+}
+
+void objParser::MeshGenerator::Iterator::operator++(int) {
+	++*this;
+}
+
+bool objParser::MeshGenerator::Iterator::operator==(std::default_sentinel_t) const noexcept {
+	return !handle || handle.done();
+}
+
+objParser::MeshGenerator::MeshGenerator() noexcept : handle(nullptr) {}
+
+objParser::MeshGenerator::MeshGenerator(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+objParser::MeshGenerator::MeshGenerator(objParser::MeshGenerator&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+objParser::MeshGenerator& objParser::MeshGenerator::operator=(objParser::MeshGenerator&& other) noexcept {
+	if (this != &other) {
+		if (handle) {
+			handle.destroy();
+		}
+		handle = std::exchange(other.handle, nullptr);
+	}
+	return *this;
+}
+
+objParser::MeshGenerator::~MeshGenerator() {
+	if (handle) {
+		handle.destroy();
+	}
+}
+
+objParser::MeshGenerator::Iterator objParser::MeshGenerator::begin() {
+	Iterator iterator(handle);
+
+	if (handle && !handle.done()) {
+		++iterator;
+	}
+
+	return iterator;
+}
+
+std::default_sentinel_t objParser::MeshGenerator::end() const noexcept {
+	return std::default_sentinel;
+}
+
+objParser::Error objParser::MeshGenerator::error() const noexcept {
+	if (!handle) {
+		return objParser::ErrorType::OK;
+	}
+	return handle.promise().error;
+}
\ No newline at end of file
@@ -1,27 +1,32 @@
 #include "../../include/CommonInclude.hpp"
 #include "../../include/MtlParser.hpp"
+#include "../../include/MappedFile.hpp"
+#include "../../include/LineTokenizer.hpp"
+#include "../../include/ChunkedLineReader.hpp"
+#include "../../include/ScratchArena.hpp"
+#include "../../include/ByteScanner.hpp"
 
 namespace MtlParserHelpers {
-	static objParser::Error ensureMaterialExists(const std::vector<objParser::Material>& materials) {
+	static objParser::Error ensureMaterialExists(const objParser::Vector<objParser::Material>& materials) {
 		if (materials.size() == 0) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Trying to read data before any meshs have been defined");
 		}
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error newMaterial(std::istream& lineStream, std::vector<objParser::Material>& materials) {
-		std::string materialName;
-		lineStream >> materialName;
+	static objParser::Error newMaterial(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
+		std::string_view materialName;
+		lineTokens.next(materialName);
 
-		materials.emplace_back(materialName);
+		materials.emplace_back(std::string(materialName));
 
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setAmbient(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setAmbient(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x, y, z;
 
-		if (!(lineStream >> x >> y >> z)) {
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in ambient failed");
 		}
 
@@ -38,10 +43,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setDiffuse(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setDiffuse(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x, y, z;
 
-		if (!(lineStream >> x >> y >> z)) {
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in diffuse failed");
 		}
 		
@@ -58,10 +63,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setSpecular(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setSpecular(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x, y, z;
 
-		if (!(lineStream >> x >> y >> z)) {
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in specular failed");
 		}
 
@@ -78,10 +83,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setSpecularExponent(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setSpecularExponent(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x;
 
-		if (!(lineStream >> x)) {
+		if (!lineTokens.next(x)) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in specular exponent failed");
 		}
 
@@ -98,10 +103,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setTransparent(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setTransparent(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x;
 
-		if (!(lineStream >> x)) {
+		if (!lineTokens.next(x)) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in transparent failed");
 		}
 
@@ -118,10 +123,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setInverseTransparent(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setInverseTransparent(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x;
 
-		if (!(lineStream >> x)) {
+		if (!lineTokens.next(x)) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in transparent failed");
 		}
 		
@@ -141,10 +146,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setTransmissionFilter(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setTransmissionFilter(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x, y, z;
 
-		if (!(lineStream >> x >> y >> z)) {
+		if (!(lineTokens.next(x) && lineTokens.next(y) && lineTokens.next(z))) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in transmission filter failed");
 		}
 
@@ -161,10 +166,10 @@ namespace MtlParserHelpers {
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error setIndexRefraction(std::istream& lineStream, std::vector<objParser::Material>& materials) {
+	static objParser::Error setIndexRefraction(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
 		float x;
 
-		if (!(lineStream >> x)) {
+		if (!lineTokens.next(x)) {
 			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in optical density/index of refraction failed");
 		}
 
@@ -180,163 +185,224 @@ namespace MtlParserHelpers {
 
 		return objParser::ErrorType::OK;
 	}
-}
-
-objParser::Error objParser::parseMtlFile(std::filesystem::path fileName, std::vector<objParser::Material>& materials) {
-	std::ifstream inFS(fileName);
 
-	if (!inFS.is_open() || !inFS.good()) {
-		std::ostringstream errorStream;
-		errorStream << "error reading material file '" << fileName << "'";
-		return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+	enum class MtlKeyword {
+		none,
+		newMaterial,
+		ambient,
+		diffuse,
+		specular,
+		specularExponent,
+		dissolve,
+		transparent,
+		transmissionFilter,
+		indexOfRefraction,
+		ignored
+	};
+
+	struct MtlKeywordEntry {
+		std::string_view name;
+		MtlKeyword keyword = MtlKeyword::none;
+	};
+
+	constexpr std::array<MtlKeywordEntry, 19> mtlKeywords = { {
+		{ "newmtl", MtlKeyword::newMaterial },
+		{ "Ka", MtlKeyword::ambient },
+		{ "Kd", MtlKeyword::diffuse },
+		{ "Ks", MtlKeyword::specular },
+		{ "Ns", MtlKeyword::specularExponent },
+		{ "d", MtlKeyword::dissolve },
+		{ "Tr", MtlKeyword::transparent },
+		{ "Tf", MtlKeyword::transmissionFilter },
+		{ "Ni", MtlKeyword::indexOfRefraction },
+
+		// recognised, but not read yet
+		{ "map_Ka", MtlKeyword::ignored },
+		{ "map_Kd", MtlKeyword::ignored },
+		{ "map_Ks", MtlKeyword::ignored },
+		{ "map_Ns", MtlKeyword::ignored },
+		{ "map_d", MtlKeyword::ignored },
+		{ "map_bump", MtlKeyword::ignored },
+		{ "bump", MtlKeyword::ignored },
+		{ "disp", MtlKeyword::ignored },
+		{ "decal", MtlKeyword::ignored },
+		{ "illum", MtlKeyword::ignored },
+	} };
+
+	constexpr size_t mtlKeywordTableSize = 32;
+
+	// the length and the first and last two bytes are enough to tell every keyword apart
+	// if a new keyword collides, the static_assert below fails and the multipliers need changing
+	constexpr size_t hashMtlKeyword(std::string_view keyword) {
+		unsigned char first = static_cast<unsigned char>(keyword.front());
+		unsigned char last = static_cast<unsigned char>(keyword.back());
+		unsigned char secondLast = static_cast<unsigned char>(keyword.size() > 1 ? keyword[keyword.size() - 2] : keyword.front());
+
+		return (keyword.size() + first * 2 + last * 6 + secondLast * 3) % mtlKeywordTableSize;
 	}
 
-	objParser::Error error = objParser::parseMtlStream(inFS, fileName, materials);
+	constexpr std::array<MtlKeywordEntry, mtlKeywordTableSize> makeMtlKeywordTable() {
+		std::array<MtlKeywordEntry, mtlKeywordTableSize> table{};
 
-	return error;
-}
-
-objParser::Error objParser::parseMtlStream(std::istream& stream, const std::filesystem::path& fileName, std::vector<objParser::Material>& materials) {
-	std::string line;
-	std::getline(stream, line);
-
-	std::istringstream lineStream(line);
+		for (const MtlKeywordEntry& entry : mtlKeywords) {
+			table[hashMtlKeyword(entry.name)] = entry;
+		}
 
-	while (!stream.fail()) {
-		std::string prefix;
-		lineStream >> prefix;
+		return table;
+	}
 
-		if (prefix == "Ka") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+	constexpr std::array<MtlKeywordEntry, mtlKeywordTableSize> mtlKeywordTable = makeMtlKeywordTable();
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+	constexpr bool mtlKeywordHashIsPerfect() {
+		for (const MtlKeywordEntry& entry : mtlKeywords) {
+			if (mtlKeywordTable[hashMtlKeyword(entry.name)].name != entry.name) {
+				return false;
 			}
+		}
 
-			error = MtlParserHelpers::setAmbient(lineStream, materials);
+		return true;
+	}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
-		} else if (prefix == "Kd") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+	static_assert(mtlKeywordHashIsPerfect(), "two mtl keywords hash to the same slot");
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+	// one hash and one compare, however many keywords there are
+	static MtlKeyword lookupKeyword(std::string_view prefix) {
+		if (prefix.empty()) {
+			return MtlKeyword::none;
+		}
 
-			error = MtlParserHelpers::setDiffuse(lineStream, materials);
+		const MtlKeywordEntry& entry = mtlKeywordTable[hashMtlKeyword(prefix)];
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		return entry.name == prefix ? entry.keyword : MtlKeyword::none;
+	}
 
-		} else if (prefix == "Ks") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+	static objParser::Error parseLine(objParser::LineTokenizer& lineTokens, objParser::Vector<objParser::Material>& materials) {
+		std::string_view prefix;
+		lineTokens.next(prefix);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		MtlKeyword keyword = lookupKeyword(prefix);
 
-			error = MtlParserHelpers::setSpecular(lineStream, materials);
+		switch (keyword) {
+		case MtlKeyword::newMaterial:
+			return MtlParserHelpers::newMaterial(lineTokens, materials);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		case MtlKeyword::none:
+		case MtlKeyword::ignored:
+			return objParser::ErrorType::OK;
 
-		} else if (prefix == "Ns") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+		default:
+			break;
+		}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		// everything else sets something on the current material
+		objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
 
-			error = MtlParserHelpers::setSpecularExponent(lineStream, materials);
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		switch (keyword) {
+		case MtlKeyword::ambient:
+			return MtlParserHelpers::setAmbient(lineTokens, materials);
 
-		} else if (prefix == "d") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+		case MtlKeyword::diffuse:
+			return MtlParserHelpers::setDiffuse(lineTokens, materials);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		case MtlKeyword::specular:
+			return MtlParserHelpers::setSpecular(lineTokens, materials);
 
-			error = MtlParserHelpers::setInverseTransparent(lineStream, materials);
+		case MtlKeyword::specularExponent:
+			return MtlParserHelpers::setSpecularExponent(lineTokens, materials);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		case MtlKeyword::dissolve:
+			return MtlParserHelpers::setInverseTransparent(lineTokens, materials);
 
-		} else if (prefix == "Tr") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+		case MtlKeyword::transparent:
+			return MtlParserHelpers::setTransparent(lineTokens, materials);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		case MtlKeyword::transmissionFilter:
+			return MtlParserHelpers::setTransmissionFilter(lineTokens, materials);
 
-			error = MtlParserHelpers::setTransparent(lineStream, materials);
+		case MtlKeyword::indexOfRefraction:
+			return MtlParserHelpers::setIndexRefraction(lineTokens, materials);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
-
-		} else if (prefix == "Tf") {
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
-
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		default:
+			return objParser::ErrorType::OK;
+		}
+	}
+}
 
-			error = MtlParserHelpers::setTransmissionFilter(lineStream, materials);
+namespace MtlParserHelpers {
+	static objParser::Error readMtlFile(const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+		if (options.memoryMap) {
+			objParser::MappedFile mappedFile;
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+			// if it cant be mapped, just fall through to the stream, which reports the error if there is one
+			if (mappedFile.open(fileName, options) == objParser::ErrorType::OK) {
+				return objParser::parseMtlBuffer(mappedFile.view(), fileName, materials);
 			}
+		}
 
-		} else if (prefix == "Ni") {
-
-			objParser::Error error = MtlParserHelpers::ensureMaterialExists(materials);
+		std::ifstream inFS(fileName);
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+		if (!inFS.is_open() || !inFS.good()) {
+			std::ostringstream errorStream;
+			errorStream << "error reading material file '" << fileName << "'";
+			return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+		}
 
-			error = MtlParserHelpers::setIndexRefraction(lineStream, materials);
+		return objParser::parseMtlStream(inFS, fileName, materials);
+	}
+}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
-			}
+objParser::Error objParser::parseMtlFile(std::filesystem::path fileName, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	objParser::Error error = MtlParserHelpers::readMtlFile(fileName, materials, options);
 
-		} else if (prefix == "map_Ka") {
+	if (options.materialIndexes != nullptr) {
+		options.materialIndexes->clear();
+		objParser::indexMaterials(materials, *options.materialIndexes);
+	}
 
-		} else if (prefix == "map_Kd") {
+	return error;
+}
 
-		} else if (prefix == "map_Ks") {
+objParser::Error objParser::parseMtlStream(std::istream& stream, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials) {
+	objParser::ScratchArena arena;
+	objParser::ChunkedLineReader lineReader(stream, objParser::ChunkedLineReader::defaultChunkSize, &arena);
+	objParser::LineTokenizer lineTokens;
 
-		} else if (prefix == "map_Ns") {
+	std::string_view line;
+	while (lineReader.nextLine(line)) {
+		lineTokens.reset(line);
 
-		} else if (prefix == "map_d") {
+		objParser::Error error = MtlParserHelpers::parseLine(lineTokens, materials);
 
-		} else if (prefix == "map_bump") {
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+	}
 
-		} else if (prefix == "bump") {
+	return objParser::ErrorType::OK;
+}
 
-		} else if (prefix == "disp") {
+objParser::Error objParser::parseMtlBuffer(std::string_view buffer, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials) {
+	objParser::LineTokenizer lineTokens;
 
-		} else if (prefix == "decal") {
+	objParser::LineSplitter lines(buffer);
+	std::string_view line;
+	while (lines.next(line)) {
+		lineTokens.reset(line);
 
-		} else if (prefix == "illum") {
+		objParser::Error error = MtlParserHelpers::parseLine(lineTokens, materials);
 
-		} else if (prefix == "newmtl") {
-			MtlParserHelpers::newMaterial(lineStream, materials);
+		if (error != objParser::ErrorType::OK) {
+			return error;
 		}
-		
-		getline(stream, line);
-		lineStream = std::istringstream(line);
 	}
 
 	return objParser::ErrorType::OK;
+}
+
+objParser::Error objParser::parseMtlBuffer(std::span<const std::byte> buffer, const std::filesystem::path& fileName, objParser::Vector<objParser::Material>& materials) {
+	return objParser::parseMtlBuffer(std::string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()), fileName, materials);
 }
\ No newline at end of file
@@ -1,345 +1,1470 @@
 #include "../../include/ObjParser.hpp"
 #include "../../include/MtlParser.hpp"
+#include "../../include/MappedFile.hpp"
+#include "../../include/LineTokenizer.hpp"
+#include "../../include/ChunkedLineReader.hpp"
+#include "../../include/ByteScanner.hpp"
+#include "../../include/EventParser.hpp"
+#include "../../include/ScratchArena.hpp"
+#include "../../include/Triangulate.hpp"
+#include "../../include/ParseCache.hpp"
+#include "../../include/RunChunks.hpp"
+
+#include <limits>
+#include <utility>
+#include <optional>
 
 
 namespace ObjParserHelpers {
-	static objParser::Error ensureObjExists(std::vector<objParser::Mesh>& meshs) {
-		if (meshs.size() == 0) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Trying to read data before any objects have been defined");
-		}
+	// how many of each attribute a mesh has
+	struct AttributeCounts {
+		size_t vertices = 0;
+		size_t vertexTextureCoordinates = 0;
+		size_t vertexNormals = 0;
+	};
 
-		return objParser::ErrorType::OK;
+	// exactly how much a mesh gets from the file, found by the counting pass so its vectors only allocate once
+	struct MeshReservation {
+		AttributeCounts attributes;
+		size_t vertexIndexes = 0;
+		size_t vertexTextureCoordinatesIndexes = 0;
+		size_t vertexNormalsIndexes = 0;
+	};
+
+	// a polygon a chunk had to fan because its corners are in an earlier chunk, it gets ear clipped once the chunks are stitched
+	// the firsts are where its triangles start in each index vector, noIndexes for one the face doesnt have
+	constexpr size_t noIndexes = std::numeric_limits<size_t>::max();
+
+	struct PendingPolygon {
+		size_t mesh;
+		size_t firstIndex;
+		size_t firstTextureIndex;
+		size_t firstNormalIndex;
+		size_t cornerCount;
+	};
+
+	struct PolygonScratch;
+
+	// everything a line can read or change besides the line itself
+	// a serial parse only fills in the first four, the rest lets a chunk of a bigger file be parsed on its own
+	struct ParseContext {
+		// everything past the references has a default, set whatever the parse needs afterwards
+		ParseContext(const std::filesystem::path& objFilePath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, objParser::MaterialIndexes& materialIndexes, const objParser::ParseOptions& options) :
+			objFilePath(objFilePath), meshs(meshs), materials(materials), materialIndexes(materialIndexes), options(options) {}
+
+		const std::filesystem::path& objFilePath;
+		objParser::Vector<objParser::Mesh>& meshs;
+		objParser::Vector<objParser::Material>& materials;
+		objParser::MaterialIndexes& materialIndexes;
+
+		// what the parse was called with, mtllib loads its files the same way
+		const objParser::ParseOptions& options;
+
+		// what the current mesh already had before the chunk started, so face indices land where they would in a serial parse
+		AttributeCounts currentMeshBase;
+
+		// set when the material libraries were loaded before the chunk was parsed
+		// holds how many materials there were after each library, so usemtl only sees what a serial parse would have
+		const std::vector<size_t>* materialsAfterLibrary = nullptr;
+		size_t librariesSeen = 0;
+		size_t visibleMaterials = std::numeric_limits<size_t>::max();
+
+		objParser::AttributeLayout layout = objParser::AttributeLayout::arrayOfStructs;
+
+		// what the parse reads, only looked at by faces, which drop the vt and vn indices of whatever isnt read
+		objParser::Attributes attributes = objParser::Attributes::all;
+
+		// set for FaceIndexing::fileWide, every v, vt and vn goes in here and faces index it instead of their mesh
+		// poolBase is how many the chunks before this one added
+		objParser::Mesh* pool = nullptr;
+		AttributeCounts poolBase;
+
+		objParser::Triangulation triangulation = objParser::Triangulation::none;
+		PolygonScratch* polygon = nullptr;
+
+		// set when this is a chunk, which cant see the positions before it to ear clip with
+		std::vector<PendingPolygon>* pendingPolygons = nullptr;
+
+		// set when options.reserveExact is on, one for what comes before the first o and then one per o
+		const std::pmr::vector<MeshReservation>* reservations = nullptr;
+		size_t objectsSeen = 0;
+	};
+
+	static void reserveMesh(objParser::Mesh& mesh, const MeshReservation& reservation, objParser::AttributeLayout layout) {
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			mesh.vertexArrays.reserve(mesh.vertexArrays.size() + reservation.attributes.vertices);
+			mesh.vertexTextureCoordinateArrays.reserve(mesh.vertexTextureCoordinateArrays.size() + reservation.attributes.vertexTextureCoordinates);
+			mesh.vertexNormalArrays.reserve(mesh.vertexNormalArrays.size() + reservation.attributes.vertexNormals);
+		} else {
+			mesh.vertices.reserve(mesh.vertices.size() + reservation.attributes.vertices);
+			mesh.vertexTextureCoordinates.reserve(mesh.vertexTextureCoordinates.size() + reservation.attributes.vertexTextureCoordinates);
+			mesh.vertexNormals.reserve(mesh.vertexNormals.size() + reservation.attributes.vertexNormals);
+		}
+		mesh.vertexIndexes.reserve(mesh.vertexIndexes.size() + reservation.vertexIndexes);
+		mesh.vertexTextureCoordinatesIndexes.reserve(mesh.vertexTextureCoordinatesIndexes.size() + reservation.vertexTextureCoordinatesIndexes);
+		mesh.vertexNormalsIndexes.reserve(mesh.vertexNormalsIndexes.size() + reservation.vertexNormalsIndexes);
 	}
 
-	static objParser::Error newObject(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs) {
-		std::string name;
-		lineStream >> name;
-		meshs.emplace_back(name);
+	static objParser::Error ensureObjExists(objParser::Vector<objParser::Mesh>& meshs) {
+		if (meshs.size() == 0) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Trying to read data before any objects have been defined");
+		}
 
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error newVertex(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs) {
+	static objParser::Error newVertex(objParser::Mesh& mesh, float x, float y, float z, float w, objParser::AttributeLayout layout) {
 		// we will ignore w
-		float x = 0, y = 0, z = 0, w = 1.0;
-		if (!(lineStream >> x >> y >> z)) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in a vertex failed");
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			mesh.vertexArrays.push_back(x / w, y / w, z / w);
+		} else {
+			mesh.vertices.emplace_back(x / w, y / w, z / w);
 		}
-		// read in w, but its not an error if its not there
-		lineStream >> w;
-
-		meshs.back().vertices.emplace_back(x / w, y / w, z / w);
 
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error newVertexNormal(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs) {
-		float x = 0, y = 0, z = 0;
-		if (!(lineStream >> x >> y >> z)) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in a vertex normal failed");
-		}
-
+	static objParser::Error newVertexNormal(objParser::Mesh& mesh, float x, float y, float z, objParser::AttributeLayout layout) {
 		// its not necessarily normalized, so normalize it to make sure
 		glm::vec3 vec(x, y, z);
 		vec = glm::normalize(vec);
 
-		meshs.back().vertexNormals.emplace_back(vec.x, vec.y, vec.z);
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			mesh.vertexNormalArrays.push_back(vec.x, vec.y, vec.z);
+		} else {
+			mesh.vertexNormals.emplace_back(vec.x, vec.y, vec.z);
+		}
 
 		return objParser::ErrorType::OK;
 	}
 
-	static objParser::Error newVertexTexture(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs) {
-		// last two are optional, but default to zero so this should be fine
-		float x = 0, y = 0, z = 0;
-		if (!(lineStream >> x)) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Reading in vertex texture (uv) coords failed");
+	static objParser::Error newVertexTexture(objParser::Mesh& mesh, float x, float y, float z, objParser::AttributeLayout layout) {
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			mesh.vertexTextureCoordinateArrays.push_back(x, y, z);
+		} else {
+			mesh.vertexTextureCoordinates.emplace_back(x, y, z);
 		}
 
-		lineStream >> y >> z;
+		return objParser::ErrorType::OK;
+	}
 
-		meshs.back().vertexTextureCoordinates.emplace_back(x, y, z);
+	static objParser::Error indexOutOfRange(const char* indexName, int64_t index, size_t count) {
+		std::ostringstream oss;
+		oss << indexName << " '" << index << "' out of range. Expected less than '" << count << "'";
+		return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+	}
 
-		return objParser::ErrorType::OK;
+	// the resolved index is never negative, it just has to fit in whatever OBJ_PARSER_INDEX_TYPE is
+	static bool fitsIndexType(int64_t index) {
+		return std::cmp_less_equal(index, std::numeric_limits<objParser::Index>::max());
 	}
-	
-	enum FaceElementType {
-		notSet,
-		v,
-		vvt,
-		vvn,
-		vvtvn
-	};
 
-	static objParser::Error newFace(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs) {
-		// f v1/vt1/vn1 v2/vt2/vn2 v3/vt3/vn3
-		std::array<std::string, 3> faces;
+	static objParser::Error indexTooWide(const char* indexName, int64_t index) {
+		std::ostringstream oss;
+		oss << indexName << " '" << index << "' doesnt fit in the index type. Expected at most '" << +std::numeric_limits<objParser::Index>::max() << "'";
+		return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+	}
 
-		if (!(lineStream >> faces[0] >> faces[1] >> faces[2])) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Must be exactly 3 verts");
-		}
-		
-		std::string temp;
-		if (lineStream >> temp) {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Face cant have more that 3 verts. Triangulate your mesh before exporting");
+	// the arenas never reuse anything, so what ear clipping frees goes back to a pool for the next polygon instead
+	// only a polygon with thousands of corners is bigger than the pool's blocks and goes straight to the arena
+	static std::pmr::pool_options clipPoolOptions() {
+		std::pmr::pool_options poolOptions;
+		poolOptions.largest_required_pool_block = 64 * 1024;
+		return poolOptions;
+	}
+
+	// reused by every face of a parse, so only the first polygon bigger than a quad allocates
+	struct PolygonScratch {
+		explicit PolygonScratch(std::pmr::memory_resource* scratch) : corners(scratch), positions(scratch), triangles(scratch), scratch(scratch) {}
+
+		// the pool takes its bookkeeping from the arena as soon as its made, so a file with nothing to clip never makes it
+		std::pmr::memory_resource* clipScratch() {
+			if (!clipPool) {
+				clipPool.emplace(clipPoolOptions(), scratch);
+			}
+			return &*clipPool;
 		}
 
-		int typeInput = FaceElementType::notSet;
+		std::pmr::vector<objParser::FaceCorner> corners;
+		std::pmr::vector<glm::vec3> positions;
+		std::pmr::vector<uint32_t> triangles;
+		std::pmr::memory_resource* scratch;
+		std::optional<std::pmr::unsynchronized_pool_resource> clipPool;
+	};
 
-		std::vector<int> tempVertexIndexes;
-		std::vector<int> tempVertexTextureCoordinatesIndexes;
-		std::vector<int> tempVertexNormalsIndexes;
+	static glm::vec3 positionOf(const objParser::Mesh& attributes, size_t index, objParser::AttributeLayout layout) {
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			return glm::vec3(attributes.vertexArrays.xs[index], attributes.vertexArrays.ys[index], attributes.vertexArrays.zs[index]);
+		}
+		return attributes.vertices[index];
+	}
 
-		for (std::string face : faces) {
-			constexpr int noIndex = 0;
-			int v = noIndex, vt = noIndex, vn = noIndex;
+	// where corner c of a polygon fanned from its first corner ended up, counted from the first index of its triangles
+	static size_t fannedCornerSlot(size_t corner) noexcept {
+		return corner < 2 ? corner : 3 * (corner - 2) + 2;
+	}
 
-			int firstSlashIndex = face.find_first_of('/');
-			int secondSlashIndex = face.find_last_of('/');
+	// the indices count from base, then through whatever attributes has, which is the mesh itself unless the parse is file wide
+	static objParser::Error newFace(const objParser::FaceCorners& faceCorners, objParser::Mesh& mesh, const objParser::Mesh& attributes, const AttributeCounts& base, ParseContext& context) {
+		if (context.triangulation == objParser::Triangulation::none && faceCorners.size() > 3) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Face cant have more that 3 verts. Triangulate your mesh before exporting");
+		}
 
-			if (firstSlashIndex != std::string::npos) {
-				face.at(firstSlashIndex) = ' ';
-				face.at(secondSlashIndex) = ' ';
-			}
+		size_t vertexCount = base.vertices + attributes.vertexCount();
+		size_t vertexTextureCount = base.vertexTextureCoordinates + attributes.vertexTextureCoordinateCount();
+		size_t vertexNormalCount = base.vertexNormals + attributes.vertexNormalCount();
 
-			int thisType = FaceElementType::notSet;
+		bool hasTexture = faceCorners.hasTextureCoordinates() && objParser::hasAttributes(context.attributes, objParser::Attributes::textureCoordinates);
+		bool hasNormal = faceCorners.hasNormals() && objParser::hasAttributes(context.attributes, objParser::Attributes::normals);
 
-			std::istringstream faceStream(face);
+		// triangles and quads stay in here, only bigger polygons go to the scratch vector
+		std::array<objParser::FaceCorner, 4> smallCorners;
+		size_t cornerCount = 0;
 
-			if (firstSlashIndex == std::string::npos) {
-				// v
-				if (!(faceStream >> v) || v == 0) {
-					return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, format: v");
-				}
-				thisType = FaceElementType::v;
-			} else  if (firstSlashIndex == secondSlashIndex) {
-				// v/vt
-				if (!(faceStream >> v >> vt) || v == 0 || vt == 0) {
-					return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, format: v/vt");
-				}
-				thisType = FaceElementType::vvt;
-			} else if (firstSlashIndex == secondSlashIndex - 1) {
-				// v//vn
-				if (!(faceStream >> v >> vn) || v == 0 || vn == 0) {
-					return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, format: v//vn");
-				}
-				thisType = FaceElementType::vvn;
+		auto addCorner = [&](const objParser::FaceCorner& faceCorner) -> objParser::Error {
+			objParser::FaceCorner* corner = nullptr;
+			if (cornerCount < smallCorners.size()) {
+				corner = &smallCorners[cornerCount];
 			} else {
-				// v/vt/vn
-				if (!(faceStream >> v >> vt >> vn) || v == 0 || vt == 0 || vn == 0) {
-					return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, format: v/vt/vn");
+				if (cornerCount == smallCorners.size()) {
+					context.polygon->corners.assign(smallCorners.begin(), smallCorners.end());
 				}
-				thisType = FaceElementType::vvtvn;
+				corner = &context.polygon->corners.emplace_back();
 			}
+			cornerCount++;
+
+			objParser::FaceCorner& element = *corner;
+			element = { faceCorner.v, hasTexture ? faceCorner.vt : 0, hasNormal ? faceCorner.vn : 0, faceCorner.format };
 
-			if (typeInput == FaceElementType::notSet) {
-				typeInput = thisType;
-			} else if (typeInput != thisType) {
-				return objParser::Error(objParser::ErrorType::FileFormatError, "Error reading face, must be all the same type of input (for example, all v//vn)");
+			int64_t rawIndex = element.v;
+			if (!objParser::resolveFaceIndex(element.v, vertexCount)) {
+				return indexOutOfRange("Vertex", rawIndex, vertexCount);
+			}
+			if (!fitsIndexType(element.v)) {
+				return indexTooWide("Vertex", rawIndex);
 			}
-			
-			if (v != noIndex) {
-				if (v < 0) {
-					v = meshs.back().vertices.size() + v;
-				} else {
-					v -= 1;
-				}
 
-				if (v > (int)meshs.back().vertices.size() - 1) {
-					std::ostringstream oss;
-					oss << "Vertex '" << vt << "' out of range. Expected less than '" << meshs.back().vertexNormals.size();
-					return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
-				}
+			rawIndex = element.vt;
+			if (element.vt != 0 && !objParser::resolveFaceIndex(element.vt, vertexTextureCount)) {
+				return indexOutOfRange("Vertex Texture", rawIndex, vertexTextureCount);
+			}
+			if (!fitsIndexType(element.vt)) {
+				return indexTooWide("Vertex Texture", rawIndex);
+			}
 
-				tempVertexIndexes.push_back(v);
+			rawIndex = element.vn;
+			if (element.vn != 0 && !objParser::resolveFaceIndex(element.vn, vertexNormalCount)) {
+				return indexOutOfRange("Vertex Normal", rawIndex, vertexNormalCount);
+			}
+			if (!fitsIndexType(element.vn)) {
+				return indexTooWide("Vertex Normal", rawIndex);
 			}
 
-			if (vt != noIndex) {
-				if (vt < 0) {
-					vt = meshs.back().vertexTextureCoordinates.size() + vt;
-				} else {
-					vt -= 1;
-				}
+			return objParser::ErrorType::OK;
+		};
 
-				if (vt > (int)meshs.back().vertices.size() - 1) {
-					std::ostringstream oss;
-					oss << "Vertex Texture '" << vt << "' out of range. Expected less than '" << meshs.back().vertexNormals.size();
-					return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
-				}
+		for (const objParser::FaceCorner& faceCorner : faceCorners) {
+			objParser::Error error = addCorner(faceCorner);
+			if (error != objParser::ErrorType::OK) {
+				return error;
+			}
+		}
+
+		// only add the face once every element has been checked, so a bad face never leaves half its indices behind
 
-				tempVertexTextureCoordinatesIndexes.push_back(vt);
+		std::span<const objParser::FaceCorner> corners = cornerCount <= smallCorners.size() ? std::span<const objParser::FaceCorner>(smallCorners.data(), cornerCount) : std::span<const objParser::FaceCorner>(context.polygon->corners);
+
+		auto addElement = [&](const objParser::FaceCorner& element) {
+			mesh.vertexIndexes.push_back(static_cast<objParser::Index>(element.v));
+
+			if (hasTexture) {
+				mesh.vertexTextureCoordinatesIndexes.push_back(static_cast<objParser::Index>(element.vt));
+			}
+			if (hasNormal) {
+				mesh.vertexNormalsIndexes.push_back(static_cast<objParser::Index>(element.vn));
 			}
+		};
 
-			if (vn != noIndex) {
-				if (vn < 0) {
-					vn = meshs.back().vertexTextureCoordinates.size() + vn;
-				} else {
-					vn -= 1;
-				}
+		if (cornerCount == 3) {
+			for (const objParser::FaceCorner& element : corners) {
+				addElement(element);
+			}
+			return objParser::ErrorType::OK;
+		}
 
-				if (vn > (int)meshs.back().vertices.size() - 1) {
-					std::ostringstream oss;
-					oss << "Vertex Normal '" << vt << "' out of range. Expected less than '" << meshs.back().vertexNormals.size();
-					return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
-				}
+		std::array<uint32_t, 6> quadTriangles;
+		std::span<uint32_t> triangles(quadTriangles);
+		if (cornerCount > 4) {
+			context.polygon->triangles.resize(3 * (cornerCount - 2));
+			triangles = context.polygon->triangles;
+		}
+
+		// a chunk only has the positions from where it starts, anything before that has to wait for the stitch
+		bool canClip = context.triangulation == objParser::Triangulation::earClipping && std::ranges::all_of(corners, [&base](const objParser::FaceCorner& element) {
+			return static_cast<size_t>(element.v) >= base.vertices;
+		});
+
+		if (canClip) {
+			std::array<glm::vec3, 4> quadPositions;
+			std::span<glm::vec3> positions(quadPositions);
+			if (cornerCount > 4) {
+				context.polygon->positions.resize(cornerCount);
+				positions = context.polygon->positions;
+			}
 
-				tempVertexNormalsIndexes.push_back(vn);
+			for (size_t i = 0; i < cornerCount; i++) {
+				positions[i] = positionOf(attributes, static_cast<size_t>(corners[i].v) - base.vertices, context.layout);
+			}
+
+			objParser::triangulatePolygon(positions.first(cornerCount), triangles, context.polygon->clipScratch());
+		} else {
+			objParser::fanPolygon(cornerCount, triangles);
+
+			if (context.triangulation == objParser::Triangulation::earClipping && context.pendingPolygons != nullptr) {
+				context.pendingPolygons->push_back({
+					context.meshs.size() - 1,
+					mesh.vertexIndexes.size(),
+					hasTexture ? mesh.vertexTextureCoordinatesIndexes.size() : noIndexes,
+					hasNormal ? mesh.vertexNormalsIndexes.size() : noIndexes,
+					cornerCount
+				});
 			}
 		}
 
-		meshs.back().vertexIndexes.insert(meshs.back().vertexIndexes.end(), tempVertexIndexes.begin(), tempVertexIndexes.end());
-		meshs.back().vertexTextureCoordinatesIndexes.insert(meshs.back().vertexTextureCoordinatesIndexes.end(), tempVertexTextureCoordinatesIndexes.begin(), tempVertexTextureCoordinatesIndexes.end());
-		meshs.back().vertexNormalsIndexes.insert(meshs.back().vertexNormalsIndexes.end(), tempVertexNormalsIndexes.begin(), tempVertexNormalsIndexes.end());
+		for (uint32_t corner : triangles) {
+			addElement(corners[corner]);
+		}
 
 		return objParser::ErrorType::OK;
 	}
 
-	static inline objParser::Error setMaterial(std::istringstream& lineStream, std::vector<objParser::Mesh>& meshs, std::vector<objParser::Material>& materials) {
-		std::string materialName;
-		lineStream >> materialName;
-		
-		auto materialNameMatches = [materialName](objParser::Material mat) -> bool {
-			return materialName == mat.name;
-		};
-		
-		
+	// only the first visibleMaterials materials can be picked, the rest come from libraries later in the file
+	static inline objParser::Error setMaterial(std::string_view materialName, objParser::Vector<objParser::Mesh>& meshs, const objParser::MaterialIndexes& materialIndexes, size_t visibleMaterials) {
+		if (auto matIterator = materialIndexes.find(materialName); matIterator != materialIndexes.end() && matIterator->second < visibleMaterials) {
+			objParser::Mesh& mesh = meshs.back();
+			mesh.mtlIndex = matIterator->second;
 
-		if (auto matIterator = std::ranges::find_if(materials, materialNameMatches); matIterator != materials.end()) {
-			meshs.back().mtlIndex = matIterator - materials.begin();
+			// only the start is known yet, finishMaterialRanges works out the counts once the mesh is done
+			mesh.materialRanges.push_back({ mesh.vertexIndexes.size(), 0, matIterator->second });
 
 			return objParser::ErrorType::OK;
 		} else {
-			return objParser::Error(objParser::ErrorType::FileFormatError, "Material '" + materialName + "' not found");
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Material '" + std::string(materialName) + "' not found");
 		}
 	}
 
-	static inline objParser::Error linkMtlFile(std::istringstream& lineStream, const std::filesystem::path& objFilePath, std::vector<objParser::Material>& materials) {
-		std::string mtlFileName;
-		lineStream >> mtlFileName;
-
+	// options.materialLibraries is only ever added to in here, by whoever loads the libraries
+	static inline objParser::Error loadMtlFile(std::string_view mtlFileName, const std::filesystem::path& objFilePath, objParser::Vector<objParser::Material>& materials, objParser::MaterialIndexes& materialIndexes, const objParser::ParseOptions& options) {
 		std::filesystem::path mtlFilePath = objFilePath / mtlFileName;
 
-		objParser::Error error = objParser::parseMtlFile(mtlFilePath, materials);
+		if (options.materialLibraries != nullptr && std::ranges::find(*options.materialLibraries, mtlFilePath) == options.materialLibraries->end()) {
+			options.materialLibraries->push_back(mtlFilePath);
+		}
+
+		// the mtl file is read the way the obj was, materialIndexes is kept up to date below instead of being rebuilt
+		objParser::ParseOptions mtlOptions;
+		mtlOptions.memoryMap = options.memoryMap;
+		mtlOptions.prefault = options.prefault;
+		mtlOptions.hugePages = options.hugePages;
+
+		size_t firstNew = materials.size();
+		objParser::Error error = objParser::parseMtlFile(mtlFilePath, materials, mtlOptions);
+
+		// even on an error, whatever it did add can be used
+		objParser::indexMaterials(materials, materialIndexes, firstNew);
 
 		return error;
 	}
-}
 
-objParser::Error objParser::parseObjFile(std::filesystem::path fileName, std::vector<objParser::Mesh>& meshs, std::vector<objParser::Material>& materials) {
-	std::ifstream inFS(fileName);
+	// the lookup usemtl goes through, the caller's one if they asked for it
+	static objParser::MaterialIndexes& startMaterialIndexes(const objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options, objParser::MaterialIndexes& localIndexes) {
+		objParser::MaterialIndexes& materialIndexes = options.materialIndexes != nullptr ? *options.materialIndexes : localIndexes;
 
-	if (!inFS.is_open() || !inFS.good()) {
-		std::ostringstream errorStream;
-		errorStream << "could not find file '" << fileName << "'";
-		return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+		materialIndexes.clear();
+		objParser::indexMaterials(materials, materialIndexes);
+
+		return materialIndexes;
 	}
 
-	objParser::Error error = parseObjStream(inFS, fileName.parent_path(), meshs, materials);
+	static inline objParser::Error linkMtlFile(std::string_view mtlFileName, ParseContext& context) {
+		// already loaded, just let the usemtl lines after this see what it added
+		if (context.materialsAfterLibrary != nullptr) {
+			context.visibleMaterials = (*context.materialsAfterLibrary)[context.librariesSeen];
+			context.librariesSeen++;
+			return objParser::ErrorType::OK;
+		}
 
-	return error;
-}
+		return loadMtlFile(mtlFileName, context.objFilePath, context.materials, context.materialIndexes, context.options);
+	}
 
-objParser::Error objParser::parseObjStream(std::istream& stream, const std::filesystem::path &objFilePath, std::vector<objParser::Mesh>& meshs, std::vector<objParser::Material>& materials) {
-	std::string line;
-	getline(stream, line);
+	// the handler every parse runs the event parser with, it puts what each line says into the meshs of its context
+	struct MeshBuilder {
+		ParseContext& context;
 
-	std::istringstream lineStream(line);
+		objParser::Error onVertex(float x, float y, float z, float w) {
+			if (context.pool != nullptr) {
+				return ObjParserHelpers::newVertex(*context.pool, x, y, z, w, context.layout);
+			}
 
-	while (!stream.fail()) {
-		std::string elementType;
-		lineStream >> elementType;
+			objParser::Error error = ObjParserHelpers::ensureObjExists(context.meshs);
 
-		if (elementType == "o") {
-			// new object
-			objParser::Error error = ObjParserHelpers::newObject(lineStream, meshs);
-			
 			if (error != objParser::ErrorType::OK) {
 				return error;
 			}
 
-		} else if (elementType == "v") {
-			// vertex
-			objParser::Error error = ObjParserHelpers::ensureObjExists(meshs);
+			return ObjParserHelpers::newVertex(context.meshs.back(), x, y, z, w, context.layout);
+		}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+		objParser::Error onNormal(float x, float y, float z) {
+			if (context.pool != nullptr) {
+				return ObjParserHelpers::newVertexNormal(*context.pool, x, y, z, context.layout);
 			}
 
-			error = ObjParserHelpers::newVertex(lineStream, meshs);
+			objParser::Error error = ObjParserHelpers::ensureObjExists(context.meshs);
 
 			if (error != objParser::ErrorType::OK) {
 				return error;
 			}
 
-		} else if (elementType == "vn") {
-			// vertex normal
-			objParser::Error error = ObjParserHelpers::ensureObjExists(meshs);
+			return ObjParserHelpers::newVertexNormal(context.meshs.back(), x, y, z, context.layout);
+		}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+		objParser::Error onTexCoord(float u, float v, float w) {
+			if (context.pool != nullptr) {
+				return ObjParserHelpers::newVertexTexture(*context.pool, u, v, w, context.layout);
 			}
 
-			error = ObjParserHelpers::newVertexNormal(lineStream, meshs);
+			objParser::Error error = ObjParserHelpers::ensureObjExists(context.meshs);
 
 			if (error != objParser::ErrorType::OK) {
 				return error;
 			}
 
-		} else if (elementType == "vt") {
-			// vertex texture
-			objParser::Error error = ObjParserHelpers::ensureObjExists(meshs);
+			return ObjParserHelpers::newVertexTexture(context.meshs.back(), u, v, w, context.layout);
+		}
+
+		objParser::Error onFace(const objParser::FaceCorners& corners) {
+			objParser::Error error = ObjParserHelpers::ensureObjExists(context.meshs);
 
 			if (error != objParser::ErrorType::OK) {
 				return error;
 			}
 
-			error = ObjParserHelpers::newVertexTexture(lineStream, meshs);
+			if (context.pool != nullptr) {
+				return ObjParserHelpers::newFace(corners, context.meshs.back(), *context.pool, context.poolBase, context);
+			}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+			return ObjParserHelpers::newFace(corners, context.meshs.back(), context.meshs.back(), context.currentMeshBase, context);
+		}
+
+		objParser::Error onObject(std::string_view name) {
+			context.currentMeshBase = {};
+			context.meshs.emplace_back(std::string(name));
+
+			if (context.reservations != nullptr) {
+				context.objectsSeen++;
+				reserveMesh(context.meshs.back(), (*context.reservations)[context.objectsSeen], context.layout);
 			}
 
-		} else if (elementType == "f") {
-			// face
-			objParser::Error error = ObjParserHelpers::ensureObjExists(meshs);
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onUseMtl(std::string_view name) {
+			objParser::Error error = ObjParserHelpers::ensureObjExists(context.meshs);
 
 			if (error != objParser::ErrorType::OK) {
 				return error;
 			}
 
-			error = ObjParserHelpers::newFace(lineStream, meshs);
+			return ObjParserHelpers::setMaterial(name, context.meshs, context.materialIndexes, context.visibleMaterials);
+		}
+
+		objParser::Error onMtlLib(std::string_view fileName) {
+			return ObjParserHelpers::linkMtlFile(fileName, context);
+		}
+	};
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+	// faces need the positions they point at to be checked and ear clipped
+	static constexpr objParser::Attributes attributesToRead(objParser::Attributes attributes) {
+		if (objParser::hasAttributes(attributes, objParser::Attributes::faces)) {
+			attributes = attributes | objParser::Attributes::positions;
+		}
+		return attributes & objParser::Attributes::all;
+	}
+
+	// only masks attributesToRead can give back get a line loop, faces without positions never does
+	template <uint8_t mask, typename Parse, typename Result>
+	static bool parseWithMask(objParser::Attributes attributes, const Parse& parse, Result& result) {
+		constexpr objParser::Attributes maskAttributes = static_cast<objParser::Attributes>(mask);
+		if constexpr (attributesToRead(maskAttributes) == maskAttributes) {
+			if (attributes == maskAttributes) {
+				result = parse.template operator()<maskAttributes>();
+				return true;
 			}
+		}
+		return false;
+	}
 
-		} else if (elementType == "usemtl") {
-			objParser::Error error = ObjParserHelpers::setMaterial(lineStream, meshs, materials);
+	// calls parse with attributes as a template argument, so every mask gets a line loop of its own with the skipped statements compiled out
+	// attributes has to have gone through attributesToRead
+	template <typename Parse, uint8_t... masks>
+	static auto withAttributes(objParser::Attributes attributes, const Parse& parse, std::integer_sequence<uint8_t, masks...>) {
+		decltype(parse.template operator()<objParser::Attributes::all>()) result;
+		(parseWithMask<masks>(attributes, parse, result) || ...);
+		return result;
+	}
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+	template <typename Parse>
+	static auto withAttributes(objParser::Attributes attributes, const Parse& parse) {
+		return withAttributes(attributes, parse, std::make_integer_sequence<uint8_t, static_cast<uint8_t>(objParser::Attributes::all) + 1>());
+	}
+
+	// parses every line in the buffer, stopping at the first error
+	static objParser::Error parseLines(std::string_view buffer, ParseContext& context) {
+		MeshBuilder builder{ context };
+		return withAttributes(context.attributes, [&]<objParser::Attributes attributes>() {
+			return objParser::parseObj<attributes>(buffer, builder);
+		});
+	}
+
+	// the counting pass, only looks at the keyword of each line and the slashes in the first face element
+	// the lines come from the simd newline scan, so this costs a lot less than the parse it saves reallocations in
+	// with polygons every face is counted to its end, otherwise only its first element is read
+	// only what attributes reads is counted
+	static void countReservations(std::string_view buffer, std::pmr::vector<MeshReservation>& reservations, bool polygons, objParser::Attributes attributes) {
+		bool positions = objParser::hasAttributes(attributes, objParser::Attributes::positions);
+		bool textureCoordinates = objParser::hasAttributes(attributes, objParser::Attributes::textureCoordinates);
+		bool normals = objParser::hasAttributes(attributes, objParser::Attributes::normals);
+		bool faces = objParser::hasAttributes(attributes, objParser::Attributes::faces);
+
+		reservations.assign(1, MeshReservation{});
+
+		objParser::LineTokenizer lineTokens;
+
+		objParser::LineSplitter lines(buffer);
+		std::string_view line;
+		while (lines.next(line)) {
+			lineTokens.reset(line);
+
+			std::string_view elementType;
+			lineTokens.next(elementType);
+
+			MeshReservation& reservation = reservations.back();
+
+			switch (objParser::classifyKeyword(elementType)) {
+			case objParser::ObjKeyword::vertex:
+				reservation.attributes.vertices += positions;
+				break;
+
+			case objParser::ObjKeyword::vertexTexture:
+				reservation.attributes.vertexTextureCoordinates += textureCoordinates;
+				break;
+
+			case objParser::ObjKeyword::vertexNormal:
+				reservation.attributes.vertexNormals += normals;
+				break;
+
+			case objParser::ObjKeyword::face: {
+				if (!faces) {
+					break;
+				}
+
+				// every element of a face has the same layout, so the first one says which index lists it adds to
+				std::string_view element;
+				lineTokens.next(element);
+
+				size_t firstSlashIndex = element.find('/');
+				size_t secondSlashIndex = element.rfind('/');
+
+				// n corners are n - 2 triangles
+				size_t faceIndexes = 3;
+				if (polygons) {
+					size_t cornerCount = 1;
+					std::string_view corner;
+					while (lineTokens.next(corner)) {
+						cornerCount++;
+					}
+					faceIndexes = 3 * (std::max<size_t>(cornerCount, 3) - 2);
+				}
+
+				reservation.vertexIndexes += faceIndexes;
+				if (textureCoordinates && firstSlashIndex != std::string_view::npos && secondSlashIndex != firstSlashIndex + 1) {
+					reservation.vertexTextureCoordinatesIndexes += faceIndexes;
+				}
+				if (normals && firstSlashIndex != secondSlashIndex) {
+					reservation.vertexNormalsIndexes += faceIndexes;
+				}
+				break;
 			}
 
-		} else if (elementType == "mtllib") {
-			objParser::Error error = ObjParserHelpers::linkMtlFile(lineStream, objFilePath, materials);
+			case objParser::ObjKeyword::object:
+				reservations.emplace_back();
+				break;
 
-			if (error != objParser::ErrorType::OK) {
-				return error;
+			default:
+				break;
 			}
+		}
+	}
+
+	// parses the buffer on the calling thread, counting first if asked to
+	static objParser::Error parseBuffer(std::string_view buffer, ParseContext& context, const objParser::ParseOptions& options, std::pmr::memory_resource* scratch) {
+		context.layout = options.layout;
+		context.attributes = attributesToRead(options.attributes);
+		context.triangulation = options.triangulation;
+
+		PolygonScratch polygon(scratch);
+		context.polygon = &polygon;
+
+		std::pmr::vector<MeshReservation> reservations(scratch);
+
+		if (options.reserveExact) {
+			countReservations(buffer, reservations, options.triangulation != objParser::Triangulation::none, context.attributes);
+			context.reservations = &reservations;
+
+			// the attributes all go to the pool, the meshs only get indices
+			if (context.pool != nullptr) {
+				MeshReservation poolReservation;
+				for (MeshReservation& reservation : reservations) {
+					poolReservation.attributes.vertices += reservation.attributes.vertices;
+					poolReservation.attributes.vertexTextureCoordinates += reservation.attributes.vertexTextureCoordinates;
+					poolReservation.attributes.vertexNormals += reservation.attributes.vertexNormals;
+					reservation.attributes = {};
+				}
+				reserveMesh(*context.pool, poolReservation, options.layout);
+			}
+
+			if (!context.meshs.empty()) {
+				reserveMesh(context.meshs.back(), reservations.front(), options.layout);
+			}
+		}
+
+		return parseLines(buffer, context);
+	}
+
+	// splits the buffer into about chunkCount pieces of the same size, each one ending just after a newline
+	static std::pmr::vector<std::string_view> splitIntoChunks(std::string_view buffer, size_t chunkCount, std::pmr::memory_resource* scratch) {
+		std::pmr::vector<std::string_view> chunks(scratch);
+		chunks.reserve(chunkCount);
+
+		const char* chunkStart = buffer.data();
+		const char* end = buffer.data() + buffer.size();
+
+		for (size_t i = 1; i <= chunkCount && chunkStart != end; i++) {
+			const char* chunkEnd = end;
+
+			if (i < chunkCount) {
+				// a long line can push the last chunk past where this one would have ended
+				const char* target = std::max(chunkStart, buffer.data() + buffer.size() / chunkCount * i);
+
+				chunkEnd = objParser::findNewline(target, end);
+				if (chunkEnd != end) {
+					chunkEnd++;
+				}
+			}
+
+			chunks.emplace_back(chunkStart, chunkEnd - chunkStart);
+			chunkStart = chunkEnd;
+		}
+
+		return chunks;
+	}
+
+	// what a chunk does to the list of meshs, worked out from the keywords alone without parsing any numbers
+	struct ChunkSummary {
+		size_t objectCount = 0;
+
+		// attributes before the first o, these carry on the mesh from the chunk before
+		AttributeCounts beforeFirstObject;
+
+		// attributes after the last o, the chunk after carries on from these
+		AttributeCounts afterLastObject;
+
+		// every attribute in the chunk, for a file wide parse
+		AttributeCounts all;
+
+		// filled on the chunk's thread, so it cant use the (single threaded) scratch arena, its only ever pushed to for mtllib lines
+		std::vector<std::string_view> materialLibraries;
+	};
+
+	// only what attributes reads is counted, so the counts match what the chunk's parse puts in its meshs
+	static void summarizeChunk(std::string_view chunk, ChunkSummary& summary, objParser::Attributes attributes) {
+		objParser::LineTokenizer lineTokens;
+
+		objParser::LineSplitter lines(chunk);
+		std::string_view line;
+		while (lines.next(line)) {
+			lineTokens.reset(line);
+
+			std::string_view elementType;
+			lineTokens.next(elementType);
+
+			switch (objParser::classifyKeyword(elementType)) {
+			case objParser::ObjKeyword::vertex:
+				if (!objParser::hasAttributes(attributes, objParser::Attributes::positions)) {
+					break;
+				}
+				summary.afterLastObject.vertices++;
+				summary.all.vertices++;
+				break;
+
+			case objParser::ObjKeyword::vertexTexture:
+				if (!objParser::hasAttributes(attributes, objParser::Attributes::textureCoordinates)) {
+					break;
+				}
+				summary.afterLastObject.vertexTextureCoordinates++;
+				summary.all.vertexTextureCoordinates++;
+				break;
+
+			case objParser::ObjKeyword::vertexNormal:
+				if (!objParser::hasAttributes(attributes, objParser::Attributes::normals)) {
+					break;
+				}
+				summary.afterLastObject.vertexNormals++;
+				summary.all.vertexNormals++;
+				break;
+
+			case objParser::ObjKeyword::object:
+				if (summary.objectCount == 0) {
+					summary.beforeFirstObject = summary.afterLastObject;
+				}
+				summary.objectCount++;
+				summary.afterLastObject = {};
+				break;
+
+			case objParser::ObjKeyword::materialLibrary: {
+				if (!objParser::hasAttributes(attributes, objParser::Attributes::faces)) {
+					break;
+				}
+
+				std::string_view mtlFileName;
+				lineTokens.next(mtlFileName);
+				summary.materialLibraries.push_back(mtlFileName);
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		if (summary.objectCount == 0) {
+			summary.beforeFirstObject = summary.afterLastObject;
+		}
+	}
+
+	// the state a serial parse would be in when it reached the start of the chunk
+	struct ChunkStart {
+		bool hasMesh = false;
+		AttributeCounts currentMesh;
+		AttributeCounts poolBase;
+		size_t visibleMaterials = 0;
+		std::vector<size_t> materialsAfterLibrary;
+	};
+
+	// not part of the output, but with OBJ_PARSER_PMR it still comes from the output's resource instead of the default one
+	static objParser::Mesh makePool([[maybe_unused]] const objParser::Vector<objParser::Mesh>::allocator_type& allocator) {
+#ifdef OBJ_PARSER_PMR
+		return objParser::Mesh("", allocator);
+#else
+		return objParser::Mesh("");
+#endif
+	}
+
+	// the chunk parsed on its own
+	struct ChunkResult {
+		// built with the output's allocator, so with OBJ_PARSER_PMR the meshs are already in the callers resource when they are moved across
+		explicit ChunkResult(const objParser::Vector<objParser::Mesh>::allocator_type& allocator) : meshs(allocator), pool(makePool(allocator)) {}
+
+		// when continuesMesh is set the first mesh only holds what the chunk added to the mesh before it
+		objParser::Vector<objParser::Mesh> meshs;
+		bool continuesMesh = false;
 
-		} else if (elementType == "#") {
-			
-		} else if (elementType == "") {
+		// the attributes the chunk added to the file wide pool
+		objParser::Mesh pool;
+		objParser::Error error;
 
+		// from the chunk's own arena
+		objParser::ScratchStatistics scratchStatistics;
+
+		// filled on the chunk's thread, like ChunkSummary::materialLibraries
+		std::vector<PendingPolygon> pendingPolygons;
+	};
+
+	// ear clips the polygons the chunks could only fan, now that every position they need is there
+	// the fan has every corner in it, so the corners are read back out of it and the triangles are written over it in place
+	static void clipPendingPolygons(objParser::Vector<objParser::Mesh>& meshs, std::span<const PendingPolygon> pendingPolygons, const objParser::Mesh* pool, const objParser::ParseOptions& options, std::pmr::memory_resource* scratch, objParser::ScratchStatistics& clipStatistics) {
+		auto clip = [&](std::span<const PendingPolygon> polygons, objParser::ScratchArena& polygonArena) {
+			std::pmr::vector<glm::vec3> positions(&polygonArena);
+			std::pmr::vector<uint32_t> triangles(&polygonArena);
+			std::pmr::vector<objParser::Index> corners(&polygonArena);
+			std::pmr::unsynchronized_pool_resource clipPool(clipPoolOptions(), &polygonArena);
+
+			for (const PendingPolygon& polygon : polygons) {
+				objParser::Mesh& mesh = meshs[polygon.mesh];
+				const objParser::Mesh& attributes = pool != nullptr ? *pool : mesh;
+
+				positions.resize(polygon.cornerCount);
+				for (size_t i = 0; i < polygon.cornerCount; i++) {
+					size_t index = static_cast<size_t>(mesh.vertexIndexes[polygon.firstIndex + fannedCornerSlot(i)]);
+					positions[i] = positionOf(attributes, index, options.layout);
+				}
+
+				triangles.resize(3 * (polygon.cornerCount - 2));
+				objParser::triangulatePolygon(positions, triangles, &clipPool);
+
+				auto rewrite = [&](objParser::Vector<objParser::Index>& indexes, size_t first) {
+					if (first == noIndexes) {
+						return;
+					}
+
+					corners.resize(polygon.cornerCount);
+					for (size_t i = 0; i < polygon.cornerCount; i++) {
+						corners[i] = indexes[first + fannedCornerSlot(i)];
+					}
+					for (size_t i = 0; i < triangles.size(); i++) {
+						indexes[first + i] = corners[triangles[i]];
+					}
+				};
+
+				rewrite(mesh.vertexIndexes, polygon.firstIndex);
+				rewrite(mesh.vertexTextureCoordinatesIndexes, polygon.firstTextureIndex);
+				rewrite(mesh.vertexNormalsIndexes, polygon.firstNormalIndex);
+			}
+		};
+
+		// every polygon writes over its own indices, so they can be shared out evenly with nothing to lock
+		size_t workerCount = std::min<size_t>(objParser::resolveThreadCount(options.threadCount), pendingPolygons.size());
+		std::pmr::vector<objParser::ScratchStatistics> workerStatistics(workerCount, scratch);
+
+		objParser::runChunks(workerCount, [&](size_t worker) {
+			size_t first = pendingPolygons.size() * worker / workerCount;
+			size_t last = pendingPolygons.size() * (worker + 1) / workerCount;
+
+			objParser::ScratchArena polygonArena;
+			clip(pendingPolygons.subspan(first, last - first), polygonArena);
+			workerStatistics[worker] = polygonArena.statistics();
+		}, scratch);
+
+		for (const objParser::ScratchStatistics& statistics : workerStatistics) {
+			clipStatistics += statistics;
+		}
+	}
+
+	template <typename Container>
+	static void appendAll(Container& to, const Container& from) {
+		to.insert(to.end(), from.begin(), from.end());
+	}
+
+	// makes room for every chunk in a row that carries on the same mesh, so the stitch copies each attribute once
+	static void reserveContinuedMesh(objParser::Mesh& mesh, std::span<const ChunkResult> results, std::pmr::memory_resource* scratch) {
+		std::pmr::vector<const objParser::Mesh*> parts(scratch);
+
+		for (const ChunkResult& result : results) {
+			if (!result.continuesMesh) {
+				break;
+			}
+
+			parts.push_back(&result.meshs.front());
+
+			// a new mesh starts in this chunk, so the ones after carry that on instead
+			if (result.meshs.size() > 1) {
+				break;
+			}
+		}
+
+		auto reserveAll = [&mesh, &parts](auto member) {
+			size_t size = (mesh.*member).size();
+			for (const objParser::Mesh* part : parts) {
+				size += (part->*member).size();
+			}
+			(mesh.*member).reserve(size);
+		};
+
+		reserveAll(&objParser::Mesh::vertices);
+		reserveAll(&objParser::Mesh::vertexTextureCoordinates);
+		reserveAll(&objParser::Mesh::vertexNormals);
+		reserveAll(&objParser::Mesh::vertexArrays);
+		reserveAll(&objParser::Mesh::vertexTextureCoordinateArrays);
+		reserveAll(&objParser::Mesh::vertexNormalArrays);
+		reserveAll(&objParser::Mesh::vertexIndexes);
+		reserveAll(&objParser::Mesh::vertexTextureCoordinatesIndexes);
+		reserveAll(&objParser::Mesh::vertexNormalsIndexes);
+	}
+
+	static void appendAttributes(objParser::Mesh& mesh, const objParser::Mesh& part) {
+		appendAll(mesh.vertices, part.vertices);
+		appendAll(mesh.vertexTextureCoordinates, part.vertexTextureCoordinates);
+		appendAll(mesh.vertexNormals, part.vertexNormals);
+		mesh.vertexArrays.append(part.vertexArrays);
+		mesh.vertexTextureCoordinateArrays.append(part.vertexTextureCoordinateArrays);
+		mesh.vertexNormalArrays.append(part.vertexNormalArrays);
+	}
+
+	static void appendContinuedMesh(objParser::Mesh& mesh, const objParser::Mesh& part) {
+		appendAttributes(mesh, part);
+		appendAll(mesh.vertexIndexes, part.vertexIndexes);
+		appendAll(mesh.vertexTextureCoordinatesIndexes, part.vertexTextureCoordinatesIndexes);
+		appendAll(mesh.vertexNormalsIndexes, part.vertexNormalsIndexes);
+
+		if (part.mtlIndex != objParser::noMaterial) {
+			mesh.mtlIndex = part.mtlIndex;
+		}
+
+		// the part's faces before its first usemtl carry on the range the mesh already ended with
+		size_t firstIndex = mesh.vertexIndexes.size() - part.vertexIndexes.size();
+		for (const objParser::MaterialRange& range : part.materialRanges) {
+			mesh.materialRanges.push_back({ firstIndex + range.firstIndex, 0, range.mtlIndex });
+		}
+	}
+
+	// parses the chunks on their own threads, then stitches them together in file order
+	// the chunks only ever fail where a serial parse would fail too, so on any error the whole thing is parsed again serially
+	// that way the error, and whatever was parsed before it, is exactly what a serial parse gives
+	// the chunks each use an arena of their own, what they did is added to chunkStatistics
+	// pool is set for a file wide parse, the chunks each fill their own part of it
+	static objParser::Error parseChunks(std::string_view buffer, std::span<const std::string_view> chunks, const std::filesystem::path& objFilePath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, objParser::MaterialIndexes& materialIndexes, objParser::Mesh* pool, const objParser::ParseOptions& options, objParser::ScratchArena& arena, objParser::ScratchStatistics& chunkStatistics) {
+		size_t chunkCount = chunks.size();
+
+		std::pmr::vector<ChunkSummary> summaries(chunkCount, &arena);
+		objParser::runChunks(chunkCount, [&](size_t i) {
+			summarizeChunk(chunks[i], summaries[i], attributesToRead(options.attributes));
+		}, &arena);
+
+		auto parseSerially = [&]() {
+			ParseContext context(objFilePath, meshs, materials, materialIndexes, options);
+			context.pool = pool;
+			return parseBuffer(buffer, context, options, &arena);
+		};
+
+		// loading a library can change materials that were already there, so keep them in case this has to start again
+		bool hasLibraries = std::ranges::any_of(summaries, [](const ChunkSummary& summary) { return !summary.materialLibraries.empty(); });
+		objParser::Vector<objParser::Material> originalMaterials(materials.get_allocator());
+		if (hasLibraries) {
+			originalMaterials = materials;
+		}
+		size_t originalLibraryCount = options.materialLibraries != nullptr ? options.materialLibraries->size() : 0;
+
+		// the serial parse loads the libraries again, and lists them again
+		auto restoreMaterials = [&]() {
+			materials = std::move(originalMaterials);
+			materialIndexes.clear();
+			objParser::indexMaterials(materials, materialIndexes);
+
+			if (options.materialLibraries != nullptr) {
+				options.materialLibraries->resize(originalLibraryCount);
+			}
+		};
+
+		// walk the summaries in file order to find where each chunk starts, loading the libraries in the order a serial parse would
+		std::pmr::vector<ChunkStart> starts(chunkCount, &arena);
+
+		bool hasMesh = !meshs.empty();
+		AttributeCounts currentMesh;
+		AttributeCounts poolBase;
+		if (hasMesh) {
+			currentMesh = { meshs.back().vertexCount(), meshs.back().vertexTextureCoordinateCount(), meshs.back().vertexNormalCount() };
+		}
+
+		for (size_t i = 0; i < chunkCount; i++) {
+			const ChunkSummary& summary = summaries[i];
+			ChunkStart& start = starts[i];
+
+			start.hasMesh = hasMesh;
+			start.currentMesh = currentMesh;
+			start.poolBase = poolBase;
+			start.visibleMaterials = materials.size();
+
+			poolBase.vertices += summary.all.vertices;
+			poolBase.vertexTextureCoordinates += summary.all.vertexTextureCoordinates;
+			poolBase.vertexNormals += summary.all.vertexNormals;
+
+			for (std::string_view mtlFileName : summary.materialLibraries) {
+				if (loadMtlFile(mtlFileName, objFilePath, materials, materialIndexes, options) != objParser::ErrorType::OK) {
+					restoreMaterials();
+					return parseSerially();
+				}
+				start.materialsAfterLibrary.push_back(materials.size());
+			}
+
+			if (summary.objectCount == 0) {
+				currentMesh.vertices += summary.beforeFirstObject.vertices;
+				currentMesh.vertexTextureCoordinates += summary.beforeFirstObject.vertexTextureCoordinates;
+				currentMesh.vertexNormals += summary.beforeFirstObject.vertexNormals;
+			} else {
+				hasMesh = true;
+				currentMesh = summary.afterLastObject;
+			}
+		}
+
+		std::pmr::vector<ChunkResult> results(&arena);
+		results.reserve(chunkCount);
+		for (size_t i = 0; i < chunkCount; i++) {
+			results.emplace_back(meshs.get_allocator());
+		}
+		objParser::runChunks(chunkCount, [&](size_t i) {
+			const ChunkStart& start = starts[i];
+			ChunkResult& result = results[i];
+
+			if (start.hasMesh) {
+				// stands in for the mesh this chunk carries on
+				result.meshs.emplace_back("");
+				result.continuesMesh = true;
+			}
+
+			objParser::ScratchArena chunkArena;
+			ParseContext context(objFilePath, result.meshs, materials, materialIndexes, options);
+			context.currentMeshBase = start.currentMesh;
+			context.materialsAfterLibrary = &start.materialsAfterLibrary;
+			context.visibleMaterials = start.visibleMaterials;
+			if (pool != nullptr) {
+				context.pool = &result.pool;
+				context.poolBase = start.poolBase;
+			}
+			context.pendingPolygons = &result.pendingPolygons;
+			result.error = parseBuffer(chunks[i], context, options, &chunkArena);
+			result.scratchStatistics = chunkArena.statistics();
+		}, &arena);
+
+		for (const ChunkResult& result : results) {
+			chunkStatistics += result.scratchStatistics;
+		}
+
+		for (const ChunkResult& result : results) {
+			if (result.error != objParser::ErrorType::OK) {
+				if (hasLibraries) {
+					restoreMaterials();
+				}
+				return parseSerially();
+			}
+		}
+
+		std::pmr::vector<PendingPolygon> pendingPolygons(&arena);
+
+		for (size_t i = 0; i < chunkCount; i++) {
+			ChunkResult& result = results[i];
+			auto newMeshs = result.meshs.begin();
+
+			// where the chunk's polygons end up once its meshs are moved across
+			size_t continuedMesh = meshs.size() - 1;
+			AttributeCounts continuedIndexes;
+
+			if (result.continuesMesh) {
+				if (i == 0 || results[i - 1].meshs.size() > (results[i - 1].continuesMesh ? 1 : 0)) {
+					reserveContinuedMesh(meshs.back(), std::span<const ChunkResult>(results).subspan(i), &arena);
+				}
+
+				continuedIndexes = { meshs.back().vertexIndexes.size(), meshs.back().vertexTextureCoordinatesIndexes.size(), meshs.back().vertexNormalsIndexes.size() };
+				appendContinuedMesh(meshs.back(), result.meshs.front());
+				newMeshs++;
+			}
+
+			size_t firstNewMesh = meshs.size() - (result.continuesMesh ? 1 : 0);
+			meshs.insert(meshs.end(), std::make_move_iterator(newMeshs), std::make_move_iterator(result.meshs.end()));
+
+			for (PendingPolygon polygon : result.pendingPolygons) {
+				if (result.continuesMesh && polygon.mesh == 0) {
+					polygon.mesh = continuedMesh;
+					polygon.firstIndex += continuedIndexes.vertices;
+					if (polygon.firstTextureIndex != noIndexes) {
+						polygon.firstTextureIndex += continuedIndexes.vertexTextureCoordinates;
+					}
+					if (polygon.firstNormalIndex != noIndexes) {
+						polygon.firstNormalIndex += continuedIndexes.vertexNormals;
+					}
+				} else {
+					polygon.mesh += firstNewMesh;
+				}
+				pendingPolygons.push_back(polygon);
+			}
+		}
+
+		// the faces already hold file wide indices, so the pool parts just go one after the other
+		if (pool != nullptr) {
+			MeshReservation poolReservation;
+			poolReservation.attributes = poolBase;
+			reserveMesh(*pool, poolReservation, options.layout);
+
+			for (const ChunkResult& result : results) {
+				appendAttributes(*pool, result.pool);
+			}
+		}
+
+		if (!pendingPolygons.empty()) {
+			clipPendingPolygons(meshs, pendingPolygons, pool, options, &arena, chunkStatistics);
+		}
+
+		return objParser::ErrorType::OK;
+	}
+
+	// fills in the counts from where the next range starts, then drops the empty ranges and merges the ones that use the same material
+	// running it again on a finished mesh changes nothing, so a mesh carried on from an earlier parse can go through it twice
+	static void finishMaterialRanges(objParser::Mesh& mesh) {
+		auto& ranges = mesh.materialRanges;
+		size_t kept = 0;
+
+		for (size_t i = 0; i < ranges.size(); i++) {
+			objParser::MaterialRange range = ranges[i];
+			size_t end = i + 1 < ranges.size() ? ranges[i + 1].firstIndex : mesh.vertexIndexes.size();
+			range.indexCount = end - range.firstIndex;
+
+			if (range.indexCount == 0) {
+				continue;
+			}
+
+			if (kept > 0 && ranges[kept - 1].mtlIndex == range.mtlIndex) {
+				ranges[kept - 1].indexCount += range.indexCount;
+			} else {
+				ranges[kept] = range;
+				kept++;
+			}
+		}
+
+		ranges.resize(kept);
+	}
+
+	// stable, so the faces of each material stay in file order, the faces before the first usemtl stay at the front
+	static void sortFacesByMaterial(objParser::Mesh& mesh, std::pmr::memory_resource* scratch) {
+		auto& ranges = mesh.materialRanges;
+		size_t cornerCount = mesh.vertexIndexes.size();
+
+		// with some faces missing their vt or vn, the index vectors dont line up and cant be moved together
+		auto linesUp = [cornerCount](const objParser::Vector<objParser::Index>& indexes) {
+			return indexes.empty() || indexes.size() == cornerCount;
+		};
+
+		if (ranges.size() < 2 || !linesUp(mesh.vertexTextureCoordinatesIndexes) || !linesUp(mesh.vertexNormalsIndexes)) {
+			return;
+		}
+
+		std::pmr::vector<objParser::MaterialRange> sorted(ranges.begin(), ranges.end(), scratch);
+		std::ranges::stable_sort(sorted, {}, &objParser::MaterialRange::mtlIndex);
+
+		std::pmr::vector<objParser::Index> original(scratch);
+		auto reorder = [&](objParser::Vector<objParser::Index>& indexes) {
+			if (indexes.empty()) {
+				return;
+			}
+
+			original.assign(indexes.begin(), indexes.end());
+
+			size_t write = ranges.front().firstIndex;
+			for (const objParser::MaterialRange& range : sorted) {
+				std::copy_n(original.begin() + range.firstIndex, range.indexCount, indexes.begin() + write);
+				write += range.indexCount;
+			}
+		};
+
+		reorder(mesh.vertexIndexes);
+		reorder(mesh.vertexTextureCoordinatesIndexes);
+		reorder(mesh.vertexNormalsIndexes);
+
+		size_t firstIndex = ranges.front().firstIndex;
+		ranges.clear();
+		for (const objParser::MaterialRange& range : sorted) {
+			if (!ranges.empty() && ranges.back().mtlIndex == range.mtlIndex) {
+				ranges.back().indexCount += range.indexCount;
+			} else {
+				ranges.push_back({ firstIndex, range.indexCount, range.mtlIndex });
+			}
+			firstIndex += range.indexCount;
+		}
+	}
+
+	// swaps the file wide indices from first on for ones into the mesh's own attributes, copying over only the pool attributes they use
+	// the copied attributes stay in file order, after whatever the mesh already had
+	static void remapAttribute(objParser::Mesh& mesh, const objParser::Mesh& pool, objParser::Vector<objParser::Index>& indexes, size_t first, objParser::Vector<glm::vec3> objParser::Mesh::* vectors, objParser::AttributeArrays objParser::Mesh::* arrays, objParser::AttributeLayout layout, std::pmr::memory_resource* scratch) {
+		if (first == indexes.size()) {
+			return;
+		}
+
+		std::pmr::vector<objParser::Index> used(indexes.begin() + first, indexes.end(), scratch);
+		std::ranges::sort(used);
+		used.erase(std::ranges::unique(used).begin(), used.end());
+
+		size_t base = 0;
+		if (layout == objParser::AttributeLayout::structOfArrays) {
+			objParser::AttributeArrays& to = mesh.*arrays;
+			const objParser::AttributeArrays& from = pool.*arrays;
+
+			base = to.size();
+			to.reserve(base + used.size());
+			for (objParser::Index index : used) {
+				size_t i = static_cast<size_t>(index);
+				to.push_back(from.xs[i], from.ys[i], from.zs[i]);
+			}
 		} else {
-			std::ostringstream oss;
-			oss << "Unexpected Line start '" << elementType << "'" << std::endl;
-			return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+			objParser::Vector<glm::vec3>& to = mesh.*vectors;
+			const objParser::Vector<glm::vec3>& from = pool.*vectors;
+
+			base = to.size();
+			to.reserve(base + used.size());
+			for (objParser::Index index : used) {
+				to.push_back(from[static_cast<size_t>(index)]);
+			}
+		}
+
+		for (size_t i = first; i < indexes.size(); i++) {
+			size_t local = std::ranges::lower_bound(used, indexes[i]) - used.begin();
+			indexes[i] = static_cast<objParser::Index>(base + local);
+		}
+	}
+
+	// where the parse's own faces start, meshs before mesh were the caller's and are left alone
+	// the caller's last mesh is carried on by the parse, so it counts as touched, but only from the indices it didnt already have
+	struct ParseStart {
+		size_t mesh = 0;
+		size_t vertexIndexes = 0;
+		size_t vertexTextureCoordinatesIndexes = 0;
+		size_t vertexNormalsIndexes = 0;
+	};
+
+	static ParseStart startOf(const objParser::Vector<objParser::Mesh>& meshs) {
+		if (meshs.empty()) {
+			return {};
+		}
+
+		const objParser::Mesh& mesh = meshs.back();
+		return { meshs.size() - 1, mesh.vertexIndexes.size(), mesh.vertexTextureCoordinatesIndexes.size(), mesh.vertexNormalsIndexes.size() };
+	}
+
+	// gives a mesh its attributes out of the pool (for a file wide parse), finishes its material ranges and sorts it if asked to
+	// the indices before start were already finished by an earlier parse, what its arena did is added to statistics
+	static void finishMesh(objParser::Mesh& mesh, const ParseStart& start, const objParser::Mesh* pool, const objParser::ParseOptions& options, objParser::ScratchStatistics& statistics) {
+		objParser::ScratchArena meshArena;
+
+		if (pool != nullptr) {
+			remapAttribute(mesh, *pool, mesh.vertexIndexes, start.vertexIndexes, &objParser::Mesh::vertices, &objParser::Mesh::vertexArrays, options.layout, &meshArena);
+			remapAttribute(mesh, *pool, mesh.vertexTextureCoordinatesIndexes, start.vertexTextureCoordinatesIndexes, &objParser::Mesh::vertexTextureCoordinates, &objParser::Mesh::vertexTextureCoordinateArrays, options.layout, &meshArena);
+			remapAttribute(mesh, *pool, mesh.vertexNormalsIndexes, start.vertexNormalsIndexes, &objParser::Mesh::vertexNormals, &objParser::Mesh::vertexNormalArrays, options.layout, &meshArena);
+		}
+
+		finishMaterialRanges(mesh);
+
+		if (options.sortFacesByMaterial) {
+			sortFacesByMaterial(mesh, &meshArena);
+		}
+
+		statistics += meshArena.statistics();
+	}
+
+	// every mesh is done on its own, so with a pool or a sort to do they are spread over options.threadCount threads
+	// each mesh uses an arena of its own, what they did is added to finishStatistics
+	static void finishMeshs(objParser::Vector<objParser::Mesh>& meshs, const ParseStart& start, const objParser::Mesh* pool, const objParser::ParseOptions& options, std::pmr::memory_resource* scratch, objParser::ScratchStatistics& finishStatistics) {
+		// only the mesh the parse carried on has indices from before it to leave alone
+		auto finishMesh = [&](size_t i, objParser::ScratchStatistics& statistics) {
+			ObjParserHelpers::finishMesh(meshs[i], i == start.mesh ? start : ParseStart{}, pool, options, statistics);
+		};
+
+		size_t meshCount = meshs.size() - std::min(start.mesh, meshs.size());
+
+		// finishing the ranges on their own isnt worth starting a thread for
+		size_t workerCount = 1;
+		if (pool != nullptr || options.sortFacesByMaterial) {
+			workerCount = std::min<size_t>(objParser::resolveThreadCount(options.threadCount), meshCount);
+		}
+
+		if (workerCount <= 1) {
+			for (size_t i = start.mesh; i < meshs.size(); i++) {
+				finishMesh(i, finishStatistics);
+			}
+			return;
+		}
+
+		// meshs can be wildly different sizes, so each thread just takes the next one when its done instead of a fixed share
+		std::pmr::vector<objParser::ScratchStatistics> workerStatistics(workerCount, scratch);
+		std::atomic<size_t> nextMesh = start.mesh;
+
+		objParser::runChunks(workerCount, [&](size_t worker) {
+			for (size_t i = nextMesh++; i < meshs.size(); i = nextMesh++) {
+				finishMesh(i, workerStatistics[worker]);
+			}
+		}, scratch);
+
+		for (const objParser::ScratchStatistics& statistics : workerStatistics) {
+			finishStatistics += statistics;
+		}
+	}
+
+	// parseObjMeshs writes these every time the caller gets control back, the generator might not be iterated to the end
+	static void writeStatistics(const objParser::ParseOptions& options, const objParser::ScratchArena& arena, const objParser::ScratchStatistics& finishStatistics) {
+		if (options.scratchStatistics != nullptr) {
+			*options.scratchStatistics = arena.statistics();
+			*options.scratchStatistics += finishStatistics;
+		}
+	}
+
+	// the line loop of parseObjMeshs, a mesh is finished and given out once the o after it has been read
+	template <objParser::Attributes attributes>
+	static objParser::MeshGenerator generateMeshs(std::istream& stream, std::filesystem::path objFilePath, objParser::Vector<objParser::Material>& materials, objParser::ParseOptions options) {
+		objParser::ScratchArena arena;
+		objParser::Vector<objParser::Mesh> meshs(objParser::Vector<objParser::Mesh>::allocator_type(materials.get_allocator()));
+		objParser::MaterialIndexes localIndexes(materials.get_allocator());
+		ParseContext context(objFilePath, meshs, materials, startMaterialIndexes(materials, options, localIndexes), options);
+		context.layout = options.layout;
+		context.attributes = attributes;
+		context.triangulation = options.triangulation;
+
+		PolygonScratch polygon(&arena);
+		context.polygon = &polygon;
+
+		objParser::Mesh pool = makePool(meshs.get_allocator());
+		if (options.faceIndexing == objParser::FaceIndexing::fileWide) {
+			context.pool = &pool;
+		}
+
+		MeshBuilder builder{ context };
+		objParser::ChunkedLineReader lineReader(stream, objParser::ChunkedLineReader::defaultChunkSize, &arena);
+		objParser::ScratchStatistics finishStatistics;
+
+		std::string_view line;
+		while (lineReader.nextLine(line)) {
+			objParser::Error error = objParser::parseObjLine<attributes>(line, builder);
+
+			if (error != objParser::ErrorType::OK) {
+				writeStatistics(options, arena, finishStatistics);
+				co_return error;
+			}
+
+			// only an o adds a mesh, so there are never more than two
+			if (meshs.size() > 1) {
+				finishMesh(meshs.front(), {}, context.pool, options, finishStatistics);
+				writeStatistics(options, arena, finishStatistics);
+				co_yield std::move(meshs.front());
+				meshs.erase(meshs.begin());
+			}
+		}
+
+		if (!meshs.empty()) {
+			finishMesh(meshs.front(), {}, context.pool, options, finishStatistics);
+			writeStatistics(options, arena, finishStatistics);
+			co_yield std::move(meshs.front());
 		}
 
-		getline(stream, line);
-		lineStream = std::istringstream(line);
+		writeStatistics(options, arena, finishStatistics);
+		co_return objParser::ErrorType::OK;
+	}
+}
+
+objParser::Error objParser::parseObjFile(std::filesystem::path fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	if (!options.cacheDirectory.empty()) {
+		return parseObjFileCached(fileName, meshs, materials, options);
+	}
+
+	if (options.memoryMap) {
+		objParser::MappedFile mappedFile;
+
+		// if it cant be mapped, just fall through to the stream, which reports the error if there is one
+		if (mappedFile.open(fileName, options) == objParser::ErrorType::OK) {
+			return parseObjBuffer(mappedFile.view(), fileName.parent_path(), meshs, materials, options);
+		}
+	}
+
+	std::ifstream inFS(fileName);
+
+	if (!inFS.is_open() || !inFS.good()) {
+		std::ostringstream errorStream;
+		errorStream << "could not find file '" << fileName << "'";
+		return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+	}
+
+	objParser::Error error = parseObjStream(inFS, fileName.parent_path(), meshs, materials, options);
+
+	return error;
+}
+
+objParser::Error objParser::parseObjStream(std::istream& stream, const std::filesystem::path &objFilePath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	objParser::ScratchArena arena;
+	ObjParserHelpers::ParseStart start = ObjParserHelpers::startOf(meshs);
+	objParser::MaterialIndexes localIndexes(materials.get_allocator());
+	ObjParserHelpers::ParseContext context(objFilePath, meshs, materials, ObjParserHelpers::startMaterialIndexes(materials, options, localIndexes), options);
+	context.layout = options.layout;
+	context.attributes = ObjParserHelpers::attributesToRead(options.attributes);
+	context.triangulation = options.triangulation;
+
+	ObjParserHelpers::PolygonScratch polygon(&arena);
+	context.polygon = &polygon;
+
+	objParser::Mesh pool = ObjParserHelpers::makePool(meshs.get_allocator());
+	if (options.faceIndexing == objParser::FaceIndexing::fileWide) {
+		context.pool = &pool;
+	}
+
+	ObjParserHelpers::MeshBuilder builder{ context };
+	objParser::Error error = ObjParserHelpers::withAttributes(context.attributes, [&]<objParser::Attributes attributes>() {
+		return objParser::parseObj<attributes>(stream, builder, &arena);
+	});
+
+	objParser::ScratchStatistics finishStatistics;
+	ObjParserHelpers::finishMeshs(meshs, start, context.pool, options, &arena, finishStatistics);
+
+	if (options.scratchStatistics != nullptr) {
+		*options.scratchStatistics = arena.statistics();
+		*options.scratchStatistics += finishStatistics;
+	}
+
+	return error;
+}
+
+objParser::Error objParser::parseObjBuffer(std::string_view buffer, const std::filesystem::path& objFilePath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	size_t threadCount = objParser::resolveThreadCount(options.threadCount);
+	size_t chunkCount = std::min(threadCount, buffer.size() / std::max<size_t>(options.minimumChunkSize, 1));
+
+	objParser::ScratchArena arena;
+	objParser::ScratchStatistics chunkStatistics;
+	objParser::ScratchStatistics finishStatistics;
+	objParser::Error error;
+
+	ObjParserHelpers::ParseStart start = ObjParserHelpers::startOf(meshs);
+	objParser::MaterialIndexes localIndexes(materials.get_allocator());
+	objParser::MaterialIndexes& materialIndexes = ObjParserHelpers::startMaterialIndexes(materials, options, localIndexes);
+
+	objParser::Mesh pool = ObjParserHelpers::makePool(meshs.get_allocator());
+	objParser::Mesh* filePool = options.faceIndexing == objParser::FaceIndexing::fileWide ? &pool : nullptr;
+
+	if (chunkCount <= 1) {
+		ObjParserHelpers::ParseContext context(objFilePath, meshs, materials, materialIndexes, options);
+		context.pool = filePool;
+		error = ObjParserHelpers::parseBuffer(buffer, context, options, &arena);
+	} else {
+		std::pmr::vector<std::string_view> chunks = ObjParserHelpers::splitIntoChunks(buffer, chunkCount, &arena);
+		error = ObjParserHelpers::parseChunks(buffer, chunks, objFilePath, meshs, materials, materialIndexes, filePool, options, arena, chunkStatistics);
+	}
+
+	ObjParserHelpers::finishMeshs(meshs, start, filePool, options, &arena, finishStatistics);
+
+	if (options.scratchStatistics != nullptr) {
+		*options.scratchStatistics = arena.statistics();
+		*options.scratchStatistics += chunkStatistics;
+		*options.scratchStatistics += finishStatistics;
+	}
+
+	return error;
+}
+
+objParser::Error objParser::parseObjBuffer(std::span<const std::byte> buffer, const std::filesystem::path& objFilePath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	return parseObjBuffer(std::string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()), objFilePath, meshs, materials, options);
+}
+
+objParser::MeshGenerator objParser::parseObjMeshs(std::filesystem::path fileName, objParser::Vector<objParser::Material>& materials, objParser::ParseOptions options) {
+	std::ifstream inFS(fileName);
+
+	if (!inFS.is_open() || !inFS.good()) {
+		std::ostringstream errorStream;
+		errorStream << "could not find file '" << fileName << "'";
+		co_return objParser::Error(objParser::ErrorType::FileNotFound, errorStream.str());
+	}
+
+	objParser::MeshGenerator meshs = parseObjMeshs(inFS, fileName.parent_path(), materials, options);
+	for (objParser::Mesh& mesh : meshs) {
+		co_yield std::move(mesh);
 	}
 
-	return objParser::ErrorType::OK;
+	co_return meshs.error();
 }
 
+objParser::MeshGenerator objParser::parseObjMeshs(std::istream& stream, std::filesystem::path objFilePath, objParser::Vector<objParser::Material>& materials, objParser::ParseOptions options) {
+	return ObjParserHelpers::withAttributes(ObjParserHelpers::attributesToRead(options.attributes), [&]<objParser::Attributes attributes>() {
+		return ObjParserHelpers::generateMeshs<attributes>(stream, objFilePath, materials, options);
+	});
+}
\ No newline at end of file
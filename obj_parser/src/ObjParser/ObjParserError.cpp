@@ -40,6 +40,9 @@ std::ostream& objParser::operator<<(std::ostream& oss, const objParser::ErrorTyp
 	case(objParser::ErrorType::FileNotFound):
 		oss << "FileNotFound";
 		break;
+	case(objParser::ErrorType::FileWriteError):
+		oss << "FileWriteError";
+		break;
 	default:
 		break;
 	}
@@ -0,0 +1,251 @@
+#include "../../include/ParseCache.hpp"
+#include "../../include/ObjParser.hpp"
+#include "../../include/BinaryCache.hpp"
+#include "../../include/ContentHash.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace ParseCacheHelpers {
+	constexpr std::string_view entryExtension = ".objcache";
+	constexpr std::string_view temporaryMarker = ".objcache.tmp";
+
+	// a temporary file this old has been left behind by a writer that never finished
+	constexpr std::chrono::hours abandonedAge(1);
+
+	// what a file that couldnt be read hashes to, so a missing mtl file that turns up later is noticed
+	constexpr uint64_t missingHash = 0;
+
+	static std::string toUtf8(const std::filesystem::path& path) {
+		std::u8string utf8 = path.u8string();
+		return std::string(reinterpret_cast<const char*>(utf8.data()), utf8.size());
+	}
+
+	static std::filesystem::path fromUtf8(std::string_view utf8) {
+		return std::filesystem::path(std::u8string(reinterpret_cast<const char8_t*>(utf8.data()), utf8.size()));
+	}
+
+	static uint64_t hashOrMissing(const std::filesystem::path& fileName) {
+		uint64_t hash;
+		if (objParser::hashFile(fileName, hash) != objParser::ErrorType::OK) {
+			return missingHash;
+		}
+		return hash;
+	}
+
+	// enough to tell a file was written to while it was being parsed, without reading all of it again
+	struct FileStamp {
+		uintmax_t size = 0;
+		std::filesystem::file_time_type lastWrite;
+
+		bool operator==(const FileStamp& other) const = default;
+	};
+
+	static bool stampFile(const std::filesystem::path& fileName, FileStamp& stamp) {
+		std::error_code error;
+		stamp.size = std::filesystem::file_size(fileName, error);
+		if (error) {
+			return false;
+		}
+		stamp.lastWrite = std::filesystem::last_write_time(fileName, error);
+		return !error;
+	}
+
+	// the same contents somewhere else can load different mtl files, and these options all change the result
+	static std::filesystem::path entryName(const std::filesystem::path& fileName, uint64_t fileHash, const objParser::ParseOptions& options) {
+		objParser::ContentHash key;
+		key.update(&fileHash, sizeof(fileHash));
+
+		std::error_code error;
+		std::string directory = toUtf8(std::filesystem::absolute(fileName, error).parent_path().lexically_normal());
+		key.update(directory.data(), directory.size());
+
+		const uint8_t resultOptions[] = {
+			static_cast<uint8_t>(options.layout),
+			static_cast<uint8_t>(options.sortFacesByMaterial),
+			static_cast<uint8_t>(options.triangulation),
+			static_cast<uint8_t>(options.faceIndexing),
+			static_cast<uint8_t>(options.attributes)
+		};
+		key.update(resultOptions, sizeof(resultOptions));
+
+		char name[17];
+		std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key.finish()));
+		return std::string(name) + std::string(entryExtension);
+	}
+
+	// the same once each that loadMtlFile keeps to, whether the libraries came from a parse or the cache
+	static void addLibrary(std::vector<std::filesystem::path>& materialLibraries, const std::filesystem::path& library) {
+		if (std::ranges::find(materialLibraries, library) == materialLibraries.end()) {
+			materialLibraries.push_back(library);
+		}
+	}
+
+	static bool loadEntry(const std::filesystem::path& entryPath, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+		objParser::BinaryCache cache;
+		if (cache.open(entryPath, options) != objParser::ErrorType::OK) {
+			return false;
+		}
+
+		for (size_t i = 0; i < cache.dependencyCount(); i++) {
+			objParser::CacheDependency dependency = cache.dependency(i);
+			if (hashOrMissing(fromUtf8(dependency.path)) != dependency.hash) {
+				return false;
+			}
+		}
+
+		cache.load(meshs, materials);
+
+		if (options.materialIndexes != nullptr) {
+			options.materialIndexes->clear();
+			objParser::indexMaterials(materials, *options.materialIndexes);
+		}
+		if (options.materialLibraries != nullptr) {
+			for (size_t i = 0; i < cache.dependencyCount(); i++) {
+				addLibrary(*options.materialLibraries, fromUtf8(cache.dependency(i).listedPath));
+			}
+		}
+		if (options.scratchStatistics != nullptr) {
+			*options.scratchStatistics = {};
+		}
+
+		// only a hint for trimParseCache, so it doesnt matter if it fails
+		std::error_code error;
+		std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), error);
+
+		return true;
+	}
+
+	// a name no other writer, in this process or any other, is going to pick at the same time
+	static std::filesystem::path temporaryPath(const std::filesystem::path& entryPath) {
+		std::random_device random;
+		uint64_t suffix = (static_cast<uint64_t>(random()) << 32) ^ random();
+
+		char name[17];
+		std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(suffix));
+
+		std::filesystem::path path = entryPath;
+		path += ".tmp";
+		path += name;
+		return path;
+	}
+
+	static void storeEntry(const std::filesystem::path& entryPath, const objParser::Vector<objParser::Mesh>& meshs, const objParser::Vector<objParser::Material>& materials, std::span<const std::filesystem::path> materialLibraries, const objParser::ParseOptions& options) {
+		std::vector<objParser::CacheDependency> dependencies;
+		dependencies.reserve(materialLibraries.size());
+		for (const std::filesystem::path& library : materialLibraries) {
+			std::error_code error;
+			dependencies.push_back({ toUtf8(std::filesystem::absolute(library, error).lexically_normal()), hashOrMissing(library), toUtf8(library) });
+		}
+
+		std::error_code error;
+		std::filesystem::create_directories(options.cacheDirectory, error);
+
+		std::filesystem::path temporary = temporaryPath(entryPath);
+		if (objParser::saveBinaryCache(temporary, meshs, materials, dependencies) != objParser::ErrorType::OK) {
+			std::filesystem::remove(temporary, error);
+			return;
+		}
+
+		// replaces whatever another writer put there in one step, readers either get the old entry or this one
+		std::filesystem::rename(temporary, entryPath, error);
+		if (error) {
+			std::filesystem::remove(temporary, error);
+			return;
+		}
+
+		objParser::trimParseCache(options.cacheDirectory, options.cacheSizeLimit);
+	}
+}
+
+objParser::Error objParser::parseObjFileCached(const std::filesystem::path& fileName, objParser::Vector<objParser::Mesh>& meshs, objParser::Vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+	objParser::ParseOptions uncachedOptions = options;
+	uncachedOptions.cacheDirectory.clear();
+
+	// usemtl can pick materials that were already there, so only a parse that starts from nothing is the same every time
+	// stamped before it is hashed, so a write any time after this is caught
+	ParseCacheHelpers::FileStamp stamp;
+	uint64_t fileHash;
+	if (!meshs.empty() || !materials.empty() || !ParseCacheHelpers::stampFile(fileName, stamp) || objParser::hashFile(fileName, fileHash) != objParser::ErrorType::OK) {
+		return parseObjFile(fileName, meshs, materials, uncachedOptions);
+	}
+
+	std::filesystem::path entryPath = options.cacheDirectory / ParseCacheHelpers::entryName(fileName, fileHash, options);
+
+	if (ParseCacheHelpers::loadEntry(entryPath, meshs, materials, options)) {
+		return objParser::ErrorType::OK;
+	}
+
+	std::vector<std::filesystem::path> materialLibraries;
+	uncachedOptions.materialLibraries = &materialLibraries;
+
+	objParser::Error error = parseObjFile(fileName, meshs, materials, uncachedOptions);
+
+	if (options.materialLibraries != nullptr) {
+		for (const std::filesystem::path& library : materialLibraries) {
+			ParseCacheHelpers::addLibrary(*options.materialLibraries, library);
+		}
+	}
+
+	// a file that changed while it was being parsed would be cached under the wrong contents
+	ParseCacheHelpers::FileStamp stampAfter;
+	if (error == objParser::ErrorType::OK && ParseCacheHelpers::stampFile(fileName, stampAfter) && stampAfter == stamp) {
+		ParseCacheHelpers::storeEntry(entryPath, meshs, materials, materialLibraries, options);
+	}
+
+	return error;
+}
+
+void objParser::trimParseCache(const std::filesystem::path& directory, uint64_t sizeLimit) {
+	struct Entry {
+		std::filesystem::path path;
+		uint64_t size;
+		std::filesystem::file_time_type lastUsed;
+	};
+
+	std::vector<Entry> entries;
+	uint64_t totalSize = 0;
+	std::filesystem::file_time_type now = std::filesystem::file_time_type::clock::now();
+
+	// other processes can be adding and removing entries the whole time, so anything that fails is just skipped
+	std::error_code error;
+	for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(directory, error)) {
+		if (!file.is_regular_file(error)) {
+			continue;
+		}
+
+		std::filesystem::file_time_type lastWrite = file.last_write_time(error);
+		if (error) {
+			continue;
+		}
+
+		std::string name = ParseCacheHelpers::toUtf8(file.path().filename());
+		if (file.path().extension() == ParseCacheHelpers::entryExtension) {
+			uint64_t size = file.file_size(error);
+			if (!error) {
+				entries.push_back({ file.path(), size, lastWrite });
+				totalSize += size;
+			}
+		} else if (name.find(ParseCacheHelpers::temporaryMarker) != std::string::npos && now - lastWrite > ParseCacheHelpers::abandonedAge) {
+			std::filesystem::remove(file.path(), error);
+		}
+	}
+
+	if (totalSize <= sizeLimit) {
+		return;
+	}
+
+	std::ranges::sort(entries, {}, &Entry::lastUsed);
+	for (const Entry& entry : entries) {
+		if (totalSize <= sizeLimit) {
+			break;
+		}
+
+		// if someone else got there first it is gone either way, but one that cant be removed (still mapped on windows) is still taking up space
+		std::filesystem::remove(entry.path, error);
+		if (!error) {
+			totalSize -= entry.size;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,572 @@
+#include "../../include/Quantize.hpp"
+#include "../../include/ByteScanner.hpp"
+
+#include <bit>
+#include <cmath>
+
+// same as ByteScanner.cpp
+#if defined(__x86_64__) || defined(_M_X64)
+	#define OBJ_PARSER_X86_SIMD
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(OBJ_PARSER_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+	#define OBJ_PARSER_TARGET(isa) __attribute__((target(isa)))
+#else
+	#define OBJ_PARSER_TARGET(isa)
+#endif
+
+namespace QuantizeHelpers {
+	// every kernel has to give exactly what the scalar one does, so the operations are done in the same order everywhere
+
+	// scalar
+
+	static inline uint16_t toUnorm16(float value, float offset, float scale) noexcept {
+		float scaled = std::min(std::max((value - offset) * scale, 0.0f), 65535.0f);
+		return static_cast<uint16_t>(std::nearbyint(scaled));
+	}
+
+	static inline int16_t toSnorm16(float value) noexcept {
+		return static_cast<int16_t>(std::nearbyint(std::min(std::max(value, -1.0f), 1.0f) * 32767.0f));
+	}
+
+	// offsets and scales go round every period values, so x, y, z (or u, v) can each have their own
+	static void unorm16Scalar(const float* values, size_t count, const float* offsets, const float* scales, size_t period, uint16_t* out) noexcept {
+		for (size_t i = 0; i < count; i++) {
+			out[i] = toUnorm16(values[i], offsets[i % period], scales[i % period]);
+		}
+	}
+
+	static void halvesScalar(const float* values, size_t count, uint16_t* out) noexcept {
+		for (size_t i = 0; i < count; i++) {
+			out[i] = objParser::floatToHalf(values[i]);
+		}
+	}
+
+	static void octahedralScalar(const float* xs, const float* ys, const float* zs, size_t count, int16_t* out) noexcept {
+		for (size_t i = 0; i < count; i++) {
+			float l1 = (std::abs(xs[i]) + std::abs(ys[i])) + std::abs(zs[i]);
+			float u = 0.0f;
+			float v = 0.0f;
+
+			if (l1 != 0.0f) {
+				u = xs[i] / l1;
+				v = ys[i] / l1;
+
+				// below the xy plane the lower half of the octahedron is folded out over the corners
+				if (zs[i] < 0.0f) {
+					float foldedU = (1.0f - std::abs(v)) * std::copysign(1.0f, u);
+					float foldedV = (1.0f - std::abs(u)) * std::copysign(1.0f, v);
+					u = foldedU;
+					v = foldedV;
+				}
+			}
+
+			out[i * 2] = toSnorm16(u);
+			out[i * 2 + 1] = toSnorm16(v);
+		}
+	}
+
+#ifdef OBJ_PARSER_X86_SIMD
+
+	// sse2, 4 floats at a time
+
+	static inline __m128i toUnorm16Sse2(__m128 values, __m128 offset, __m128 scale) noexcept {
+		__m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(values, offset), scale), _mm_setzero_ps()), _mm_set1_ps(65535.0f));
+
+		// sse2 can only pack to signed 16 bit, so move into that range here and flip the top bit back after packing
+		return _mm_sub_epi32(_mm_cvtps_epi32(scaled), _mm_set1_epi32(32768));
+	}
+
+	static void unorm16Sse2(const float* values, size_t count, const float* offsets, const float* scales, size_t period, uint16_t* out) noexcept {
+		// 12 is a whole number of both 2 and 3 component attributes, so the same three offset and scale registers line up every time
+		alignas(16) float offsetPattern[12];
+		alignas(16) float scalePattern[12];
+		for (size_t i = 0; i < 12; i++) {
+			offsetPattern[i] = offsets[i % period];
+			scalePattern[i] = scales[i % period];
+		}
+
+		const __m128 offset0 = _mm_load_ps(offsetPattern);
+		const __m128 offset1 = _mm_load_ps(offsetPattern + 4);
+		const __m128 offset2 = _mm_load_ps(offsetPattern + 8);
+		const __m128 scale0 = _mm_load_ps(scalePattern);
+		const __m128 scale1 = _mm_load_ps(scalePattern + 4);
+		const __m128 scale2 = _mm_load_ps(scalePattern + 8);
+		const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+
+		size_t i = 0;
+		for (; count - i >= 12; i += 12) {
+			__m128i a = toUnorm16Sse2(_mm_loadu_ps(values + i), offset0, scale0);
+			__m128i b = toUnorm16Sse2(_mm_loadu_ps(values + i + 4), offset1, scale1);
+			__m128i c = toUnorm16Sse2(_mm_loadu_ps(values + i + 8), offset2, scale2);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(_mm_packs_epi32(a, b), flip));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i + 8), _mm_xor_si128(_mm_packs_epi32(c, c), flip));
+		}
+
+		unorm16Scalar(values + i, count - i, offsets, scales, period, out + i);
+	}
+
+	static void octahedralSse2(const float* xs, const float* ys, const float* zs, size_t count, int16_t* out) noexcept {
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 minusOne = _mm_set1_ps(-1.0f);
+		const __m128 snormScale = _mm_set1_ps(32767.0f);
+
+		size_t i = 0;
+		for (; count - i >= 4; i += 4) {
+			__m128 x = _mm_loadu_ps(xs + i);
+			__m128 y = _mm_loadu_ps(ys + i);
+			__m128 z = _mm_loadu_ps(zs + i);
+
+			__m128 l1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signBit, x), _mm_andnot_ps(signBit, y)), _mm_andnot_ps(signBit, z));
+			__m128 u = _mm_div_ps(x, l1);
+			__m128 v = _mm_div_ps(y, l1);
+
+			__m128 foldedU = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signBit, v)), _mm_or_ps(_mm_and_ps(signBit, u), one));
+			__m128 foldedV = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signBit, u)), _mm_or_ps(_mm_and_ps(signBit, v), one));
+			__m128 below = _mm_cmplt_ps(z, zero);
+			u = _mm_or_ps(_mm_and_ps(below, foldedU), _mm_andnot_ps(below, u));
+			v = _mm_or_ps(_mm_and_ps(below, foldedV), _mm_andnot_ps(below, v));
+
+			// a zero length normal divided by zero above, it has no direction so it gets (0, 0)
+			__m128 empty = _mm_cmpeq_ps(l1, zero);
+			u = _mm_andnot_ps(empty, u);
+			v = _mm_andnot_ps(empty, v);
+
+			__m128i packedU = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(u, minusOne), one), snormScale));
+			__m128i packedV = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, minusOne), one), snormScale));
+			packedU = _mm_packs_epi32(packedU, packedU);
+			packedV = _mm_packs_epi32(packedV, packedV);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_unpacklo_epi16(packedU, packedV));
+		}
+
+		octahedralScalar(xs + i, ys + i, zs + i, count - i, out + i * 2);
+	}
+
+	// avx2, 8 floats at a time
+
+	OBJ_PARSER_TARGET("avx2")
+	static inline __m256i toUnorm16Avx2(__m256 values, __m256 offset, __m256 scale) noexcept {
+		__m256 scaled = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(values, offset), scale), _mm256_setzero_ps()), _mm256_set1_ps(65535.0f));
+		return _mm256_cvtps_epi32(scaled);
+	}
+
+	OBJ_PARSER_TARGET("avx2")
+	static void unorm16Avx2(const float* values, size_t count, const float* offsets, const float* scales, size_t period, uint16_t* out) noexcept {
+		alignas(32) float offsetPattern[24];
+		alignas(32) float scalePattern[24];
+		for (size_t i = 0; i < 24; i++) {
+			offsetPattern[i] = offsets[i % period];
+			scalePattern[i] = scales[i % period];
+		}
+
+		const __m256 offset0 = _mm256_load_ps(offsetPattern);
+		const __m256 offset1 = _mm256_load_ps(offsetPattern + 8);
+		const __m256 offset2 = _mm256_load_ps(offsetPattern + 16);
+		const __m256 scale0 = _mm256_load_ps(scalePattern);
+		const __m256 scale1 = _mm256_load_ps(scalePattern + 8);
+		const __m256 scale2 = _mm256_load_ps(scalePattern + 16);
+
+		size_t i = 0;
+		for (; count - i >= 24; i += 24) {
+			__m256i a = toUnorm16Avx2(_mm256_loadu_ps(values + i), offset0, scale0);
+			__m256i b = toUnorm16Avx2(_mm256_loadu_ps(values + i + 8), offset1, scale1);
+			__m256i c = toUnorm16Avx2(_mm256_loadu_ps(values + i + 16), offset2, scale2);
+
+			// packus works inside each 128 bit half, the permute puts the quarters back in order
+			__m256i ab = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+			__m256i cc = _mm256_permute4x64_epi64(_mm256_packus_epi32(c, c), 0xD8);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), ab);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 16), _mm256_castsi256_si128(cc));
+		}
+
+		unorm16Sse2(values + i, count - i, offsets, scales, period, out + i);
+	}
+
+	OBJ_PARSER_TARGET("avx2,f16c")
+	static void halvesF16c(const float* values, size_t count, uint16_t* out) noexcept {
+		size_t i = 0;
+		for (; count - i >= 8; i += 8) {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		halvesScalar(values + i, count - i, out + i);
+	}
+
+	OBJ_PARSER_TARGET("avx2")
+	static void octahedralAvx2(const float* xs, const float* ys, const float* zs, size_t count, int16_t* out) noexcept {
+		const __m256 signBit = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 minusOne = _mm256_set1_ps(-1.0f);
+		const __m256 snormScale = _mm256_set1_ps(32767.0f);
+
+		size_t i = 0;
+		for (; count - i >= 8; i += 8) {
+			__m256 x = _mm256_loadu_ps(xs + i);
+			__m256 y = _mm256_loadu_ps(ys + i);
+			__m256 z = _mm256_loadu_ps(zs + i);
+
+			__m256 l1 = _mm256_add_ps(_mm256_add_ps(_mm256_andnot_ps(signBit, x), _mm256_andnot_ps(signBit, y)), _mm256_andnot_ps(signBit, z));
+			__m256 u = _mm256_div_ps(x, l1);
+			__m256 v = _mm256_div_ps(y, l1);
+
+			__m256 foldedU = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signBit, v)), _mm256_or_ps(_mm256_and_ps(signBit, u), one));
+			__m256 foldedV = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_andnot_ps(signBit, u)), _mm256_or_ps(_mm256_and_ps(signBit, v), one));
+			__m256 below = _mm256_cmp_ps(z, zero, _CMP_LT_OQ);
+			u = _mm256_blendv_ps(u, foldedU, below);
+			v = _mm256_blendv_ps(v, foldedV, below);
+
+			__m256 empty = _mm256_cmp_ps(l1, zero, _CMP_EQ_OQ);
+			u = _mm256_andnot_ps(empty, u);
+			v = _mm256_andnot_ps(empty, v);
+
+			__m256i packedU = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(u, minusOne), one), snormScale));
+			__m256i packedV = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(v, minusOne), one), snormScale));
+			packedU = _mm256_packs_epi32(packedU, packedU);
+			packedV = _mm256_packs_epi32(packedV, packedV);
+
+			// everything stays inside its 128 bit half, and each half is already 4 normals in order
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2), _mm256_unpacklo_epi16(packedU, packedV));
+		}
+
+		octahedralSse2(xs + i, ys + i, zs + i, count - i, out + i * 2);
+	}
+
+	static bool detectF16c() noexcept {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 29)) != 0;
+	#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("f16c");
+	#endif
+	}
+
+#endif
+
+	struct QuantizeFunctions {
+		void (*unorm16)(const float*, size_t, const float*, const float*, size_t, uint16_t*) noexcept;
+		void (*halves)(const float*, size_t, uint16_t*) noexcept;
+		void (*octahedral)(const float*, const float*, const float*, size_t, int16_t*) noexcept;
+	};
+
+	static QuantizeFunctions functionsFor(objParser::SimdLevel level) noexcept {
+		switch (level) {
+#ifdef OBJ_PARSER_X86_SIMD
+		case objParser::SimdLevel::avx512:
+		case objParser::SimdLevel::avx2: {
+			// every avx2 cpu so far has f16c too, but its its own cpuid bit
+			static const bool hasF16c = detectF16c();
+			return { unorm16Avx2, hasF16c ? halvesF16c : halvesScalar, octahedralAvx2 };
+		}
+		case objParser::SimdLevel::sse2:
+			// sse2 has nothing for halves
+			return { unorm16Sse2, halvesScalar, octahedralSse2 };
+#endif
+		default:
+			return { unorm16Scalar, halvesScalar, octahedralScalar };
+		}
+	}
+
+	// the attribute as x, y, z, x, y, z..., only copied when some of it is in the structure of arrays layout
+	static std::span<const float> interleaved(std::span<const glm::vec3> vectors, const objParser::AttributeArrays& arrays, std::vector<float>& scratch) {
+		static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+
+		if (arrays.empty()) {
+			return std::span<const float>(reinterpret_cast<const float*>(vectors.data()), vectors.size() * 3);
+		}
+
+		scratch.clear();
+		scratch.reserve((vectors.size() + arrays.size()) * 3);
+		for (const glm::vec3& vector : vectors) {
+			scratch.insert(scratch.end(), { vector.x, vector.y, vector.z });
+		}
+		for (size_t i = 0; i < arrays.size(); i++) {
+			scratch.insert(scratch.end(), { arrays.xs[i], arrays.ys[i], arrays.zs[i] });
+		}
+
+		return scratch;
+	}
+
+	// the other way round, only copied when some of it is in the glm layout
+	static const objParser::AttributeArrays& deinterleaved(std::span<const glm::vec3> vectors, const objParser::AttributeArrays& arrays, objParser::AttributeArrays& scratch) {
+		if (vectors.empty()) {
+			return arrays;
+		}
+
+		scratch.reserve(vectors.size() + arrays.size());
+		for (const glm::vec3& vector : vectors) {
+			scratch.push_back(vector.x, vector.y, vector.z);
+		}
+		scratch.append(arrays);
+
+		return scratch;
+	}
+
+	static objParser::Error checkFinite(std::span<const float> values, size_t components, const objParser::Mesh& mesh, const char* attributeName) {
+		for (size_t i = 0; i < values.size(); i++) {
+			if (!std::isfinite(values[i])) {
+				std::ostringstream oss;
+				oss << attributeName << " '" << i / components + 1 << "' in mesh '" << mesh.name << "' isnt finite, so it cant be quantized";
+				return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+			}
+		}
+
+		return objParser::ErrorType::OK;
+	}
+
+	// smallest and largest of each component, offsets and scales are then set so the range fills 0 to 65535
+	static void unorm16Range(std::span<const float> values, size_t components, float* minimums, float* maximums, float* scales) {
+		for (size_t c = 0; c < components; c++) {
+			minimums[c] = 0.0f;
+			maximums[c] = 0.0f;
+		}
+
+		for (size_t i = 0; i < values.size(); i++) {
+			size_t c = i % components;
+			if (i < components || values[i] < minimums[c]) {
+				minimums[c] = values[i];
+			}
+			if (i < components || values[i] > maximums[c]) {
+				maximums[c] = values[i];
+			}
+		}
+
+		for (size_t c = 0; c < components; c++) {
+			float extent = maximums[c] - minimums[c];
+			scales[c] = extent > 0.0f ? 65535.0f / extent : 0.0f;
+		}
+	}
+
+	static inline float unorm16ToFloat(uint16_t value, float minimum, float maximum) noexcept {
+		return minimum + value * ((maximum - minimum) / 65535.0f);
+	}
+
+}
+
+uint16_t objParser::floatToHalf(float value) noexcept {
+	uint32_t bits = std::bit_cast<uint32_t>(value);
+	uint32_t sign = (bits >> 16) & 0x8000;
+	uint32_t magnitude = bits & 0x7fffffff;
+
+	// inf stays inf, nan stays a (quiet) nan
+	if (magnitude >= 0x7f800000) {
+		return static_cast<uint16_t>(sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 | ((magnitude >> 13) & 0x3ff) : 0));
+	}
+
+	// 65520 and up round past the largest half
+	if (magnitude >= 0x477ff000) {
+		return static_cast<uint16_t>(sign | 0x7c00);
+	}
+
+	// too small for a normal half, it becomes a subnormal (a multiple of 2^-24)
+	if (magnitude < 0x38800000) {
+		if (magnitude < 0x33000000) {
+			return static_cast<uint16_t>(sign);
+		}
+
+		uint32_t exponent = magnitude >> 23;
+		uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+		uint32_t shift = 126 - exponent;
+
+		uint32_t half = mantissa >> shift;
+		uint32_t remainder = mantissa & ((1u << shift) - 1);
+		uint32_t midpoint = 1u << (shift - 1);
+		if (remainder > midpoint || (remainder == midpoint && (half & 1) != 0)) {
+			half++;
+		}
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	// rebias the exponent from 127 to 15 and round the mantissa to nearest even, a carry rolls into the exponent on its own
+	uint32_t half = (magnitude - 0x38000000) >> 13;
+	uint32_t remainder = magnitude & 0x1fff;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0)) {
+		half++;
+	}
+
+	return static_cast<uint16_t>(sign | half);
+}
+
+float objParser::halfToFloat(uint16_t half) noexcept {
+	uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+	uint32_t exponent = (half >> 10) & 0x1f;
+	uint32_t mantissa = half & 0x3ff;
+
+	if (exponent == 0) {
+		float value = std::ldexp(static_cast<float>(mantissa), -24);
+		return sign != 0 ? -value : value;
+	}
+
+	if (exponent == 31) {
+		return std::bit_cast<float>(sign | 0x7f800000 | (mantissa << 13));
+	}
+
+	return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+objParser::QuantizedMesh::QuantizedMesh() :
+	mtlIndex(0),
+	boundsMin(0.0f),
+	boundsMax(0.0f),
+	textureCoordinateEncoding(objParser::TextureCoordinateEncoding::half),
+	textureCoordinateMin(0.0f),
+	textureCoordinateMax(0.0f),
+	maxPositionError(0.0f),
+	maxTextureCoordinateError(0.0f),
+	maxNormalError(0.0f) {}
+
+size_t objParser::QuantizedMesh::vertexCount() const noexcept {
+	return positions.size() / 3;
+}
+
+size_t objParser::QuantizedMesh::vertexTextureCoordinateCount() const noexcept {
+	return textureCoordinates.size() / 2;
+}
+
+size_t objParser::QuantizedMesh::vertexNormalCount() const noexcept {
+	return normals.size() / 2;
+}
+
+glm::vec3 objParser::QuantizedMesh::position(size_t i) const noexcept {
+	return glm::vec3(
+		QuantizeHelpers::unorm16ToFloat(positions[i * 3], boundsMin.x, boundsMax.x),
+		QuantizeHelpers::unorm16ToFloat(positions[i * 3 + 1], boundsMin.y, boundsMax.y),
+		QuantizeHelpers::unorm16ToFloat(positions[i * 3 + 2], boundsMin.z, boundsMax.z)
+	);
+}
+
+glm::vec2 objParser::QuantizedMesh::textureCoordinate(size_t i) const noexcept {
+	if (textureCoordinateEncoding == objParser::TextureCoordinateEncoding::half) {
+		return glm::vec2(objParser::halfToFloat(textureCoordinates[i * 2]), objParser::halfToFloat(textureCoordinates[i * 2 + 1]));
+	}
+
+	return glm::vec2(
+		QuantizeHelpers::unorm16ToFloat(textureCoordinates[i * 2], textureCoordinateMin.x, textureCoordinateMax.x),
+		QuantizeHelpers::unorm16ToFloat(textureCoordinates[i * 2 + 1], textureCoordinateMin.y, textureCoordinateMax.y)
+	);
+}
+
+glm::vec3 objParser::QuantizedMesh::normal(size_t i) const noexcept {
+	float u = std::max(normals[i * 2] / 32767.0f, -1.0f);
+	float v = std::max(normals[i * 2 + 1] / 32767.0f, -1.0f);
+	float z = 1.0f - std::abs(u) - std::abs(v);
+
+	if (z < 0.0f) {
+		float unfoldedU = (1.0f - std::abs(v)) * std::copysign(1.0f, u);
+		float unfoldedV = (1.0f - std::abs(u)) * std::copysign(1.0f, v);
+		u = unfoldedU;
+		v = unfoldedV;
+	}
+
+	return glm::normalize(glm::vec3(u, v, z));
+}
+
+objParser::Error objParser::quantizeMesh(const objParser::Mesh& mesh, objParser::QuantizedMesh& quantizedMesh, const objParser::QuantizeOptions& options) {
+	quantizedMesh = objParser::QuantizedMesh();
+	quantizedMesh.name = std::string_view(mesh.name);
+	quantizedMesh.mtlIndex = mesh.mtlIndex;
+	quantizedMesh.materialRanges.assign(mesh.materialRanges.begin(), mesh.materialRanges.end());
+	quantizedMesh.textureCoordinateEncoding = options.textureCoordinateEncoding;
+
+	QuantizeHelpers::QuantizeFunctions functions = QuantizeHelpers::functionsFor(objParser::activeSimdLevel());
+
+	// positions
+
+	std::vector<float> positionScratch;
+	std::span<const float> positions = QuantizeHelpers::interleaved(mesh.vertices, mesh.vertexArrays, positionScratch);
+
+	objParser::Error error = QuantizeHelpers::checkFinite(positions, 3, mesh, "Vertex");
+	if (error != objParser::ErrorType::OK) {
+		return error;
+	}
+
+	float positionScales[3];
+	QuantizeHelpers::unorm16Range(positions, 3, &quantizedMesh.boundsMin.x, &quantizedMesh.boundsMax.x, positionScales);
+
+	quantizedMesh.positions.resize(positions.size());
+	functions.unorm16(positions.data(), positions.size(), &quantizedMesh.boundsMin.x, positionScales, 3, quantizedMesh.positions.data());
+
+	// texture coordinates, only u and v
+
+	std::vector<float> textureCoordinates;
+	textureCoordinates.reserve(mesh.vertexTextureCoordinateCount() * 2);
+	for (const glm::vec3& textureCoordinate : mesh.vertexTextureCoordinates) {
+		textureCoordinates.insert(textureCoordinates.end(), { textureCoordinate.x, textureCoordinate.y });
+	}
+	for (size_t i = 0; i < mesh.vertexTextureCoordinateArrays.size(); i++) {
+		textureCoordinates.insert(textureCoordinates.end(), { mesh.vertexTextureCoordinateArrays.xs[i], mesh.vertexTextureCoordinateArrays.ys[i] });
+	}
+
+	error = QuantizeHelpers::checkFinite(textureCoordinates, 2, mesh, "Vertex Texture");
+	if (error != objParser::ErrorType::OK) {
+		return error;
+	}
+
+	quantizedMesh.textureCoordinates.resize(textureCoordinates.size());
+	if (options.textureCoordinateEncoding == objParser::TextureCoordinateEncoding::half) {
+		functions.halves(textureCoordinates.data(), textureCoordinates.size(), quantizedMesh.textureCoordinates.data());
+	} else {
+		float textureCoordinateScales[2];
+		QuantizeHelpers::unorm16Range(textureCoordinates, 2, &quantizedMesh.textureCoordinateMin.x, &quantizedMesh.textureCoordinateMax.x, textureCoordinateScales);
+		functions.unorm16(textureCoordinates.data(), textureCoordinates.size(), &quantizedMesh.textureCoordinateMin.x, textureCoordinateScales, 2, quantizedMesh.textureCoordinates.data());
+	}
+
+	// normals
+
+	objParser::AttributeArrays normalScratch;
+	const objParser::AttributeArrays& normals = QuantizeHelpers::deinterleaved(mesh.vertexNormals, mesh.vertexNormalArrays, normalScratch);
+
+	for (std::span<const float> component : { normals.x(), normals.y(), normals.z() }) {
+		error = QuantizeHelpers::checkFinite(component, 1, mesh, "Vertex Normal");
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+	}
+
+	quantizedMesh.normals.resize(normals.size() * 2);
+	functions.octahedral(normals.xs.data(), normals.ys.data(), normals.zs.data(), normals.size(), quantizedMesh.normals.data());
+
+	quantizedMesh.vertexIndexes.assign(mesh.vertexIndexes.begin(), mesh.vertexIndexes.end());
+	quantizedMesh.vertexTextureCoordinatesIndexes.assign(mesh.vertexTextureCoordinatesIndexes.begin(), mesh.vertexTextureCoordinatesIndexes.end());
+	quantizedMesh.vertexNormalsIndexes.assign(mesh.vertexNormalsIndexes.begin(), mesh.vertexNormalsIndexes.end());
+
+	// measure what was actually lost rather than trusting the step sizes
+
+	for (size_t i = 0; i < quantizedMesh.vertexCount(); i++) {
+		glm::vec3 difference = glm::abs(quantizedMesh.position(i) - glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]));
+		quantizedMesh.maxPositionError = std::max({ quantizedMesh.maxPositionError, difference.x, difference.y, difference.z });
+	}
+
+	for (size_t i = 0; i < quantizedMesh.vertexTextureCoordinateCount(); i++) {
+		glm::vec2 difference = glm::abs(quantizedMesh.textureCoordinate(i) - glm::vec2(textureCoordinates[i * 2], textureCoordinates[i * 2 + 1]));
+		quantizedMesh.maxTextureCoordinateError = std::max({ quantizedMesh.maxTextureCoordinateError, difference.x, difference.y });
+	}
+
+	// the distance between two unit vectors goes up with the angle between them, so only the largest needs turning into an angle
+	// (and unlike acos of the dot product it doesnt lose the tiny angles)
+	float maxNormalDistance = 0.0f;
+	for (size_t i = 0; i < quantizedMesh.vertexNormalCount(); i++) {
+		glm::vec3 normal(normals.xs[i], normals.ys[i], normals.zs[i]);
+		if (normal == glm::vec3(0.0f)) {
+			// no direction to lose
+			continue;
+		}
+
+		maxNormalDistance = std::max(maxNormalDistance, glm::length(glm::normalize(normal) - quantizedMesh.normal(i)));
+	}
+	quantizedMesh.maxNormalError = 2.0f * std::asin(std::min(maxNormalDistance * 0.5f, 1.0f));
+
+	return objParser::ErrorType::OK;
+}
\ No newline at end of file
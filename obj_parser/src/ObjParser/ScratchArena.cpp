@@ -0,0 +1,57 @@
+#include "../../include/ScratchArena.hpp"
+
+objParser::ScratchStatistics& objParser::ScratchStatistics::operator+=(const objParser::ScratchStatistics& other) noexcept {
+	allocations += other.allocations;
+	bytes += other.bytes;
+	heapAllocations += other.heapAllocations;
+
+	return *this;
+}
+
+objParser::ScratchArena::CountingUpstream::CountingUpstream(std::pmr::memory_resource* upstream, objParser::ScratchStatistics& statistics) noexcept :
+	upstream(upstream),
+	statistics(statistics) {}
+
+void* objParser::ScratchArena::CountingUpstream::do_allocate(size_t bytes, size_t alignment) {
+	void* pointer = upstream->allocate(bytes, alignment);
+	statistics.heapAllocations++;
+	return pointer;
+}
+
+void objParser::ScratchArena::CountingUpstream::do_deallocate(void* pointer, size_t bytes, size_t alignment) noexcept {
+	upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool objParser::ScratchArena::CountingUpstream::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
+
+objParser::ScratchArena::ScratchArena(std::pmr::memory_resource* upstream) noexcept :
+	countingUpstream(upstream, scratchStatistics),
+	buffer(inlineBuffer, inlineSize, &countingUpstream) {}
+
+void objParser::ScratchArena::release() noexcept {
+	buffer.release();
+}
+
+const objParser::ScratchStatistics& objParser::ScratchArena::statistics() const noexcept {
+	return scratchStatistics;
+}
+
+void* objParser::ScratchArena::do_allocate(size_t bytes, size_t alignment) {
+	void* pointer = buffer.allocate(bytes, alignment);
+
+	scratchStatistics.allocations++;
+	scratchStatistics.bytes += bytes;
+
+	return pointer;
+}
+
+void objParser::ScratchArena::do_deallocate(void* pointer, size_t bytes, size_t alignment) noexcept {
+	// does nothing, everything waits for release
+	buffer.deallocate(pointer, bytes, alignment);
+}
+
+bool objParser::ScratchArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
\ No newline at end of file
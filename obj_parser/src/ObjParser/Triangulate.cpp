@@ -0,0 +1,181 @@
+#include "../../include/Triangulate.hpp"
+
+namespace TriangulateHelpers {
+	// the polygon flattened onto the plane it mostly lies in, so the rest is 2d
+	struct Projection {
+		int u = 0;
+		int v = 1;
+
+		// +1 if the polygon winds counter clockwise in (u, v), -1 if it doesnt
+		float winding = 1.0f;
+
+		glm::vec2 operator()(const glm::vec3& position) const noexcept {
+			return glm::vec2(position[u], position[v]);
+		}
+	};
+
+	// drops the axis the newell normal points along most, which keeps the polygon from collapsing onto a line
+	static Projection project(std::span<const glm::vec3> positions) {
+		glm::vec3 normal(0.0f);
+		for (size_t i = 0; i < positions.size(); i++) {
+			const glm::vec3& a = positions[i];
+			const glm::vec3& b = positions[(i + 1) % positions.size()];
+			normal.x += (a.y - b.y) * (a.z + b.z);
+			normal.y += (a.z - b.z) * (a.x + b.x);
+			normal.z += (a.x - b.x) * (a.y + b.y);
+		}
+
+		glm::vec3 size = glm::abs(normal);
+
+		Projection projection;
+		if (size.x >= size.y && size.x >= size.z) {
+			projection = { 1, 2, normal.x >= 0.0f ? 1.0f : -1.0f };
+		} else if (size.y >= size.z) {
+			projection = { 2, 0, normal.y >= 0.0f ? 1.0f : -1.0f };
+		} else {
+			projection = { 0, 1, normal.z >= 0.0f ? 1.0f : -1.0f };
+		}
+
+		return projection;
+	}
+
+	static float cross(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c) noexcept {
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	}
+
+	// on the edge counts as inside, so an ear never has a corner touching it
+	static bool inTriangle(const glm::vec2& p, const glm::vec2& a, const glm::vec2& b, const glm::vec2& c, float winding) noexcept {
+		return cross(a, b, p) * winding >= 0.0f && cross(b, c, p) * winding >= 0.0f && cross(c, a, p) * winding >= 0.0f;
+	}
+
+	static void writeTriangle(std::span<uint32_t> triangles, size_t& written, size_t a, size_t b, size_t c) noexcept {
+		triangles[written++] = static_cast<uint32_t>(a);
+		triangles[written++] = static_cast<uint32_t>(b);
+		triangles[written++] = static_cast<uint32_t>(c);
+	}
+
+	// a quad has at most one reflex corner, fanning from it always works
+	static void splitQuad(std::span<const glm::vec3> positions, std::span<uint32_t> triangles, const Projection& projection) noexcept {
+		size_t first = 0;
+		for (size_t i = 0; i < 4; i++) {
+			glm::vec2 previous = projection(positions[(i + 3) % 4]);
+			glm::vec2 corner = projection(positions[i]);
+			glm::vec2 next = projection(positions[(i + 1) % 4]);
+
+			if (cross(previous, corner, next) * projection.winding < 0.0f) {
+				first = i;
+				break;
+			}
+		}
+
+		size_t written = 0;
+		writeTriangle(triangles, written, first, (first + 1) % 4, (first + 2) % 4);
+		writeTriangle(triangles, written, first, (first + 2) % 4, (first + 3) % 4);
+	}
+
+	static bool isConvex(std::span<const glm::vec3> positions, const Projection& projection) noexcept {
+		size_t count = positions.size();
+		for (size_t i = 0; i < count; i++) {
+			glm::vec2 previous = projection(positions[(i + count - 1) % count]);
+			glm::vec2 corner = projection(positions[i]);
+			glm::vec2 next = projection(positions[(i + 1) % count]);
+
+			if (cross(previous, corner, next) * projection.winding < 0.0f) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static void clipEars(std::span<const glm::vec3> positions, std::span<uint32_t> triangles, const Projection& projection, std::pmr::memory_resource* scratch) {
+		std::pmr::vector<glm::vec2> points(scratch);
+		points.reserve(positions.size());
+		for (const glm::vec3& position : positions) {
+			points.push_back(projection(position));
+		}
+
+		std::pmr::vector<uint32_t> remaining(positions.size(), scratch);
+		for (size_t i = 0; i < remaining.size(); i++) {
+			remaining[i] = static_cast<uint32_t>(i);
+		}
+
+		auto isEar = [&](size_t i) {
+			size_t count = remaining.size();
+			uint32_t previous = remaining[(i + count - 1) % count];
+			uint32_t corner = remaining[i];
+			uint32_t next = remaining[(i + 1) % count];
+
+			const glm::vec2& a = points[previous];
+			const glm::vec2& b = points[corner];
+			const glm::vec2& c = points[next];
+
+			if (cross(a, b, c) * projection.winding <= 0.0f) {
+				return false;
+			}
+
+			for (uint32_t other : remaining) {
+				if (other == previous || other == corner || other == next) {
+					continue;
+				}
+				// a corner sitting on top of one of the ear's (a repeated vertex) doesnt stop it
+				const glm::vec2& p = points[other];
+				if (p == a || p == b || p == c) {
+					continue;
+				}
+				if (inTriangle(p, a, b, c, projection.winding)) {
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		size_t written = 0;
+		size_t i = 0;
+		while (remaining.size() > 3) {
+			size_t count = remaining.size();
+
+			// carry on from the last ear instead of starting over, which gives fewer slivers
+			size_t tried = 0;
+			while (tried < count && !isEar(i % count)) {
+				i++;
+				tried++;
+			}
+			// nothing is an ear when the polygon crosses itself or is flat, so just cut wherever it got to
+			i %= count;
+
+			writeTriangle(triangles, written, remaining[(i + count - 1) % count], remaining[i], remaining[(i + 1) % count]);
+			remaining.erase(remaining.begin() + i);
+			if (i == remaining.size()) {
+				i = 0;
+			}
+		}
+
+		writeTriangle(triangles, written, remaining[0], remaining[1], remaining[2]);
+	}
+}
+
+void objParser::fanPolygon(size_t cornerCount, std::span<uint32_t> triangles) noexcept {
+	size_t written = 0;
+	for (size_t i = 1; i + 1 < cornerCount; i++) {
+		TriangulateHelpers::writeTriangle(triangles, written, 0, i, i + 1);
+	}
+}
+
+void objParser::triangulatePolygon(std::span<const glm::vec3> positions, std::span<uint32_t> triangles, std::pmr::memory_resource* scratch) {
+	if (positions.size() == 3) {
+		objParser::fanPolygon(3, triangles);
+		return;
+	}
+
+	TriangulateHelpers::Projection projection = TriangulateHelpers::project(positions);
+
+	if (positions.size() == 4) {
+		TriangulateHelpers::splitQuad(positions, triangles, projection);
+	} else if (TriangulateHelpers::isConvex(positions, projection)) {
+		objParser::fanPolygon(positions.size(), triangles);
+	} else {
+		TriangulateHelpers::clipEars(positions, triangles, projection, scratch);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "../../include/VertexBuffer.hpp"
+#include "../../include/RunChunks.hpp"
+
+#include <atomic>
+#include <limits>
+#include <utility>
+
+namespace VertexBufferHelpers {
+	// any index type fits in 64 bits
+	constexpr uint64_t noIndex = std::numeric_limits<uint64_t>::max();
+
+	// one face corner, noIndex where the faces dont have that index
+	struct Corner {
+		uint64_t v;
+		uint64_t vt;
+		uint64_t vn;
+
+		bool operator==(const Corner& other) const noexcept = default;
+	};
+
+	static inline uint64_t hashCorner(const Corner& corner) noexcept {
+		uint64_t hash = corner.v * 0x9E3779B97F4A7C15ull;
+		hash ^= corner.vt * 0xC2B2AE3D27D4EB4Full;
+		hash ^= corner.vn * 0x165667B19E3779F9ull;
+
+		// the multiplies only push bits up, so fold the top half back down before masking
+		return hash ^ (hash >> 32);
+	}
+
+	// open addressing with linear probing, the key and the vertex it maps to sit together so a probe touches one cache line
+	class CornerTable {
+	public:
+		explicit CornerTable(size_t expectedSize) : used(0) {
+			size_t capacity = 16;
+			while (capacity < expectedSize * 2) {
+				capacity *= 2;
+			}
+			slots.assign(capacity, Slot{ {}, emptySlot });
+		}
+
+		// hands back the vertex already made for this corner, or gives it newVertex if its the first time its been seen
+		uint32_t findOrInsert(const Corner& corner, uint32_t newVertex) {
+			// keep it at most half full so probes stay short
+			if ((used + 1) * 2 > slots.size()) {
+				grow();
+			}
+
+			size_t mask = slots.size() - 1;
+			for (size_t i = hashCorner(corner) & mask;; i = (i + 1) & mask) {
+				Slot& slot = slots[i];
+
+				if (slot.vertex == emptySlot) {
+					slot = Slot{ corner, newVertex };
+					used++;
+					return newVertex;
+				}
+
+				if (slot.corner == corner) {
+					return slot.vertex;
+				}
+			}
+		}
+
+	private:
+		static constexpr uint32_t emptySlot = std::numeric_limits<uint32_t>::max();
+
+		struct Slot {
+			Corner corner;
+			uint32_t vertex;
+		};
+
+		void grow() {
+			std::vector<Slot> oldSlots(slots.size() * 2, Slot{ {}, emptySlot });
+			oldSlots.swap(slots);
+
+			size_t mask = slots.size() - 1;
+			for (const Slot& slot : oldSlots) {
+				if (slot.vertex == emptySlot) {
+					continue;
+				}
+
+				size_t i = hashCorner(slot.corner) & mask;
+				while (slots[i].vertex != emptySlot) {
+					i = (i + 1) & mask;
+				}
+				slots[i] = slot;
+			}
+		}
+
+		std::vector<Slot> slots;
+		size_t used;
+	};
+
+	// a mesh only ever has one layout filled by the parser, but if both are the glm vectors come first like the counts say
+	static inline glm::vec3 readAttribute(std::span<const glm::vec3> vectors, const objParser::AttributeArrays& arrays, uint64_t index) {
+		size_t i = static_cast<size_t>(index);
+
+		if (i < vectors.size()) {
+			return vectors[i];
+		}
+
+		i -= vectors.size();
+		return glm::vec3(arrays.xs[i], arrays.ys[i], arrays.zs[i]);
+	}
+
+	static objParser::Error checkIndexes(const objParser::Mesh& mesh, const objParser::Vector<objParser::Index>& indexes, size_t count, const char* indexName) {
+		for (objParser::Index index : indexes) {
+			if (std::cmp_less(index, 0) || std::cmp_greater_equal(index, count)) {
+				std::ostringstream oss;
+				oss << indexName << " '" << +index << "' out of range in mesh '" << mesh.name << "'. Expected less than '" << count << "'";
+				return objParser::Error(objParser::ErrorType::FileFormatError, oss.str());
+			}
+		}
+
+		return objParser::ErrorType::OK;
+	}
+
+	static objParser::Error checkMesh(const objParser::Mesh& mesh) {
+		size_t cornerCount = mesh.vertexIndexes.size();
+
+		// the index lists only line up when every face has the same format
+		if ((!mesh.vertexTextureCoordinatesIndexes.empty() && mesh.vertexTextureCoordinatesIndexes.size() != cornerCount) || (!mesh.vertexNormalsIndexes.empty() && mesh.vertexNormalsIndexes.size() != cornerCount)) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Mesh '" + std::string(mesh.name) + "' mixes face formats, so it cant be welded into one index buffer");
+		}
+
+		if (cornerCount > std::numeric_limits<uint32_t>::max()) {
+			return objParser::Error(objParser::ErrorType::FileFormatError, "Mesh '" + std::string(mesh.name) + "' has too many face corners for 32 bit indices");
+		}
+
+		objParser::Error error = checkIndexes(mesh, mesh.vertexIndexes, mesh.vertexCount(), "Vertex");
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+
+		error = checkIndexes(mesh, mesh.vertexTextureCoordinatesIndexes, mesh.vertexTextureCoordinateCount(), "Vertex Texture");
+		if (error != objParser::ErrorType::OK) {
+			return error;
+		}
+
+		return checkIndexes(mesh, mesh.vertexNormalsIndexes, mesh.vertexNormalCount(), "Vertex Normal");
+	}
+
+	static void appendVertex(const objParser::Mesh& mesh, const Corner& corner, const objParser::VertexLayout& layout, std::vector<float>& vertices) {
+		for (objParser::VertexAttribute attribute : layout.attributes) {
+			switch (attribute) {
+			case objParser::VertexAttribute::position: {
+				glm::vec3 position = readAttribute(mesh.vertices, mesh.vertexArrays, corner.v);
+				vertices.insert(vertices.end(), { position.x, position.y, position.z });
+				break;
+			}
+
+			case objParser::VertexAttribute::textureCoordinate: {
+				glm::vec3 textureCoordinate = corner.vt == noIndex ? glm::vec3(0.0f) : readAttribute(mesh.vertexTextureCoordinates, mesh.vertexTextureCoordinateArrays, corner.vt);
+				for (unsigned i = 0; i < std::min(layout.textureCoordinateComponents, 3u); i++) {
+					vertices.push_back(textureCoordinate[i]);
+				}
+				break;
+			}
+
+			case objParser::VertexAttribute::normal: {
+				glm::vec3 normal = corner.vn == noIndex ? glm::vec3(0.0f) : readAttribute(mesh.vertexNormals, mesh.vertexNormalArrays, corner.vn);
+				vertices.insert(vertices.end(), { normal.x, normal.y, normal.z });
+				break;
+			}
+			}
+		}
+	}
+}
+
+size_t objParser::VertexLayout::stride() const noexcept {
+	size_t floats = 0;
+
+	for (objParser::VertexAttribute attribute : attributes) {
+		floats += attribute == objParser::VertexAttribute::textureCoordinate ? std::min(textureCoordinateComponents, 3u) : 3;
+	}
+
+	return floats;
+}
+
+size_t objParser::VertexLayout::offset(objParser::VertexAttribute attribute) const noexcept {
+	size_t floats = 0;
+
+	for (objParser::VertexAttribute layoutAttribute : attributes) {
+		if (layoutAttribute == attribute) {
+			return floats;
+		}
+		floats += layoutAttribute == objParser::VertexAttribute::textureCoordinate ? std::min(textureCoordinateComponents, 3u) : 3;
+	}
+
+	return npos;
+}
+
+size_t objParser::VertexBuffer::vertexCount() const noexcept {
+	size_t stride = layout.stride();
+	return stride == 0 ? 0 : vertices.size() / stride;
+}
+
+objParser::Error objParser::buildVertexBuffer(const objParser::Mesh& mesh, objParser::VertexBuffer& vertexBuffer, const objParser::VertexLayout& layout) {
+	vertexBuffer.layout = layout;
+	vertexBuffer.vertices.clear();
+	vertexBuffer.indices.clear();
+
+	objParser::Error error = VertexBufferHelpers::checkMesh(mesh);
+	if (error != objParser::ErrorType::OK) {
+		return error;
+	}
+
+	size_t cornerCount = mesh.vertexIndexes.size();
+	bool hasTexture = !mesh.vertexTextureCoordinatesIndexes.empty();
+	bool hasNormal = !mesh.vertexNormalsIndexes.empty();
+
+	// most meshs end up with about as many welded vertices as positions, so start there
+	VertexBufferHelpers::CornerTable table(mesh.vertexCount());
+	vertexBuffer.indices.reserve(cornerCount);
+	vertexBuffer.vertices.reserve(std::min(mesh.vertexCount(), cornerCount) * layout.stride());
+
+	uint32_t vertexCount = 0;
+	for (size_t i = 0; i < cornerCount; i++) {
+		VertexBufferHelpers::Corner corner{
+			static_cast<uint64_t>(mesh.vertexIndexes[i]),
+			hasTexture ? static_cast<uint64_t>(mesh.vertexTextureCoordinatesIndexes[i]) : VertexBufferHelpers::noIndex,
+			hasNormal ? static_cast<uint64_t>(mesh.vertexNormalsIndexes[i]) : VertexBufferHelpers::noIndex
+		};
+
+		uint32_t vertex = table.findOrInsert(corner, vertexCount);
+		if (vertex == vertexCount) {
+			VertexBufferHelpers::appendVertex(mesh, corner, layout, vertexBuffer.vertices);
+			vertexCount++;
+		}
+
+		vertexBuffer.indices.push_back(vertex);
+	}
+
+	return objParser::ErrorType::OK;
+}
+
+objParser::Error objParser::buildVertexBuffers(std::span<const objParser::Mesh> meshs, std::vector<objParser::VertexBuffer>& vertexBuffers, const objParser::VertexLayout& layout, unsigned threadCount) {
+	vertexBuffers.assign(meshs.size(), objParser::VertexBuffer{});
+
+	std::vector<objParser::Error> errors(meshs.size());
+	std::atomic<size_t> nextMesh = 0;
+
+	// meshs can be wildly different sizes, so each thread just takes the next one when its done instead of a fixed share
+	size_t workerCount = std::min<size_t>(objParser::resolveThreadCount(threadCount), meshs.size());
+	objParser::runChunks(workerCount, [&](size_t) {
+		for (size_t i = nextMesh++; i < meshs.size(); i = nextMesh++) {
+			errors[i] = objParser::buildVertexBuffer(meshs[i], vertexBuffers[i], layout);
+		}
+	});
+
+	for (size_t i = 0; i < meshs.size(); i++) {
+		if (errors[i] != objParser::ErrorType::OK) {
+			return errors[i];
+		}
+	}
+
+	return objParser::ErrorType::OK;
+}
\ No newline at end of file
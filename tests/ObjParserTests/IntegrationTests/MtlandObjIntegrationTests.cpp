@@ -21,4 +21,46 @@ TEST(MtlandObjIntegrationTests, linksMtlFile) {
 	ASSERT_EQ(materials.size(), 2);
 
 	EXPECT_EQ(meshs.at(0).mtlIndex, 1);
+}
+
+TEST(MtlandObjIntegrationTests, looksMaterialsUpByName) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	// whatever was in there before has to go
+	objParser::MaterialIndexes materialIndexes = { { "stale", 7 } };
+	objParser::ParseOptions options;
+	options.materialIndexes = &materialIndexes;
+
+	ASSERT_EQ(objParser::parseObjFile("../tests/TestAssets/objTest3.obj", meshs, materials, options), objParser::ErrorType::OK);
+
+	ASSERT_EQ(materialIndexes.size(), 2);
+	EXPECT_EQ(materialIndexes.find(std::string_view("t1"))->second, 0);
+	EXPECT_EQ(materialIndexes.find(std::string_view("t2"))->second, meshs.at(0).mtlIndex);
+	EXPECT_EQ(materialIndexes.find(std::string_view("stale")), materialIndexes.end());
+
+	materials.clear();
+	ASSERT_EQ(objParser::parseMtlFile("../tests/TestAssets/mtlTest3_1.mtl", materials, options), objParser::ErrorType::OK);
+	EXPECT_EQ(materialIndexes.size(), 2);
+	EXPECT_EQ(materialIndexes.at("t2"), 1);
+}
+
+TEST(MtlandObjIntegrationTests, usemtlPicksTheFirstMaterialWithTheName) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials = { objParser::Material("a"), objParser::Material("b"), objParser::Material("a") };
+
+	objParser::MaterialIndexes materialIndexes;
+	objParser::ParseOptions options;
+	options.materialIndexes = &materialIndexes;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o x\nusemtl b\nusemtl a", "", meshs, materials, options), objParser::ErrorType::OK);
+
+	EXPECT_EQ(meshs.at(0).mtlIndex, 0);
+	EXPECT_EQ(materialIndexes.size(), 2);
+	EXPECT_EQ(materialIndexes.at("a"), 0);
+	EXPECT_EQ(materialIndexes.at("b"), 1);
+
+	objParser::Error error = objParser::parseObjBuffer("o y\nusemtl c", "", meshs, materials, options);
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(error.message, "Material 'c' not found");
 }
\ No newline at end of file
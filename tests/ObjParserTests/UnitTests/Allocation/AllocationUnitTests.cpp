@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+
+namespace AllocationTestHelpers {
+	// nothing but sums, so any allocation the parse makes is its own
+	struct SummingHandler {
+		size_t objects = 0;
+		size_t corners = 0;
+		float sum = 0;
+
+		objParser::Error onObject(std::string_view) { objects++; return objParser::ErrorType::OK; }
+		objParser::Error onVertex(float x, float y, float z, float w) { sum += x + y + z + w; return objParser::ErrorType::OK; }
+		objParser::Error onNormal(float x, float y, float z) { sum += x + y + z; return objParser::ErrorType::OK; }
+		objParser::Error onTexCoord(float u, float v, float w) { sum += u + v + w; return objParser::ErrorType::OK; }
+		objParser::Error onFace(const objParser::FaceCorners& face) {
+			for (const objParser::FaceCorner& corner : face) {
+				corners++;
+				sum += static_cast<float>(corner.v);
+			}
+			return objParser::ErrorType::OK;
+		}
+		objParser::Error onUseMtl(std::string_view) { return objParser::ErrorType::OK; }
+		objParser::Error onMtlLib(std::string_view) { return objParser::ErrorType::OK; }
+	};
+
+	// counts what is asked of it and passes it on to upstream
+	class CountingResource : public std::pmr::memory_resource {
+	public:
+		explicit CountingResource(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+
+		size_t allocations = 0;
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			allocations++;
+			return upstream->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+			upstream->deallocate(pointer, bytes, alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+
+		std::pmr::memory_resource* upstream;
+	};
+}
+
+TEST(EventParserAllocation, parsingABufferAllocatesNothing) {
+	std::string obj = "mtllib a.mtl\no mesh\nusemtl red\n";
+	for (int i = 0; i < 1000; i++) {
+		obj += "v 1.5 2 3\nvt 0.5 0.5\nvn 0 1 0\n";
+		obj += "f 1/1/1 2/2/2 3/3/3 4/4/4 5/5/5 6/6/6 7/7/7 8/8/8\n";
+	}
+
+	AllocationTestHelpers::SummingHandler handler;
+
+	AllocationTestHelpers::allocations = 0;
+	AllocationTestHelpers::counting = true;
+	objParser::Error error = objParser::parseObj(std::string_view(obj), handler);
+	AllocationTestHelpers::counting = false;
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	EXPECT_EQ(handler.corners, 8000);
+	EXPECT_EQ(AllocationTestHelpers::allocations, 0);
+}
+
+TEST(EventParserAllocation, parsingAStreamOnlyAllocatesFromScratch) {
+	std::string obj = "o mesh\n";
+	for (int i = 0; i < 1000; i++) {
+		obj += "v 1.5 2 3\nf 1 2 3 4 5\n";
+	}
+	std::istringstream stream(obj);
+
+	// the memory is set aside before counting starts, so the scratch resource doesnt go to the heap either
+	std::vector<std::byte> memory(1 << 20);
+	std::pmr::monotonic_buffer_resource buffer(memory.data(), memory.size(), std::pmr::null_memory_resource());
+	AllocationTestHelpers::CountingResource scratch(&buffer);
+
+	AllocationTestHelpers::SummingHandler handler;
+
+	AllocationTestHelpers::allocations = 0;
+	AllocationTestHelpers::counting = true;
+	objParser::Error error = objParser::parseObj(stream, handler, &scratch);
+	AllocationTestHelpers::counting = false;
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	EXPECT_EQ(handler.corners, 5000);
+	EXPECT_EQ(AllocationTestHelpers::allocations, 0);
+
+	// the buffer the stream is read through, and nothing for any line
+	EXPECT_EQ(scratch.allocations, 1);
+}
\ No newline at end of file
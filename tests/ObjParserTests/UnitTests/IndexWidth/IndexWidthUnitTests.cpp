@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <string>
+
+namespace IndexWidthTestHelpers {
+	inline std::string makeObjWithVertices(int vertexCount) {
+		std::string contents = "o t\n";
+		for (int i = 0; i < vertexCount; i++) {
+			contents += "v 0 0 0\n";
+		}
+		return contents;
+	}
+}
+
+TEST(IndexWidth, storesTheChosenType) {
+	static_assert(std::is_same_v<objParser::Index, uint16_t>);
+	static_assert(std::is_same_v<decltype(objParser::Mesh::vertexIndexes), std::vector<uint16_t>>);
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nv 0 0 0\nv 0 0 0\nf 1 2 -1", "", meshs, materials), objParser::ErrorType::OK);
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<uint16_t>({ 0, 1, 2 }));
+}
+
+TEST(IndexWidth, acceptsTheLargestIndex) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	std::string contents = IndexWidthTestHelpers::makeObjWithVertices(70000) + "f 65536 1 -4465\n";
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<uint16_t>({ 65535, 0, 65535 }));
+}
+
+TEST(IndexWidth, rejectsIndicesPastTheType) {
+	std::string contents = IndexWidthTestHelpers::makeObjWithVertices(70000);
+
+	// the second one is only too big once its been resolved against the vertex count
+	for (std::string face : { "f 65537 1 2", "f 1 2 -1" }) {
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+
+		objParser::Error error = objParser::parseObjBuffer(contents + face, "", meshs, materials);
+
+		EXPECT_EQ(error, objParser::ErrorType::FileFormatError) << face;
+		EXPECT_NE(error.message.find("doesnt fit in the index type"), std::string::npos) << error.message;
+		EXPECT_TRUE(meshs.at(0).vertexIndexes.empty());
+	}
+}
+
+TEST(IndexWidth, weldsNarrowIndices) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\nf 3 2 1", "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::VertexBuffer vertexBuffer;
+	ASSERT_EQ(objParser::buildVertexBuffer(meshs.at(0), vertexBuffer), objParser::ErrorType::OK);
+	EXPECT_EQ(vertexBuffer.indices, std::vector<uint32_t>({ 0, 1, 2, 2, 1, 0 }));
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+constexpr std::string_view attributeMaskTestObj =
+	"mtllib doesntExist.mtl\n"
+	"o a\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"v 1 1 1\n"
+	"vt 0 0\n"
+	"vt 1 0\n"
+	"vn 0 0 2\n"
+	"f 1/1/1 2/2/1 3/1/1 4/2/1\n"
+	"o b\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"vn 0 1 0\n"
+	"f 1//1 2//1 3//1\n"
+	"f -1//-1 -2//-1 -3//-1\n";
+
+namespace AttributeMaskTestHelpers {
+	inline objParser::Error parse(std::string_view obj, std::vector<objParser::Mesh>& meshs, const objParser::ParseOptions& options) {
+		std::vector<objParser::Material> materials;
+		return objParser::parseObjBuffer(obj, "", meshs, materials, options);
+	}
+
+	// a big file, so the threaded parse really splits it
+	inline std::string makeObj() {
+		std::string obj;
+		for (int mesh = 0; mesh < 20; mesh++) {
+			obj += "o mesh" + std::to_string(mesh) + "\n";
+			for (int i = 0; i < 50; i++) {
+				obj += "v " + std::to_string(i) + " " + std::to_string(mesh) + " 1\n";
+				obj += "vt 0." + std::to_string(i) + " 0.5\n";
+				obj += "vn 1 " + std::to_string(i) + " 0\n";
+			}
+			for (int i = 1; i <= 47; i++) {
+				obj += "f " + std::to_string(i) + "/" + std::to_string(i) + "/" + std::to_string(i) + " -2/-2/-2 -1/-1/-1 " + std::to_string(i + 1) + "/1/1\n";
+			}
+		}
+		return obj;
+	}
+
+	// what the full parse gives, with everything the mask doesnt read emptied out
+	inline void expectMasked(const std::vector<objParser::Mesh>& masked, const std::vector<objParser::Mesh>& full, objParser::Attributes attributes) {
+		bool faces = objParser::hasAttributes(attributes, objParser::Attributes::faces);
+		bool positions = faces || objParser::hasAttributes(attributes, objParser::Attributes::positions);
+		bool textureCoordinates = objParser::hasAttributes(attributes, objParser::Attributes::textureCoordinates);
+		bool normals = objParser::hasAttributes(attributes, objParser::Attributes::normals);
+
+		ASSERT_EQ(masked.size(), full.size());
+		for (size_t i = 0; i < full.size(); i++) {
+			const objParser::Mesh& mesh = masked[i];
+			const objParser::Mesh& expected = full[i];
+			std::vector<objParser::Index> none;
+
+			EXPECT_EQ(mesh.name, expected.name);
+			EXPECT_EQ(mesh.vertices, positions ? expected.vertices : std::vector<glm::vec3>()) << mesh.name;
+			EXPECT_EQ(mesh.vertexTextureCoordinates, textureCoordinates ? expected.vertexTextureCoordinates : std::vector<glm::vec3>()) << mesh.name;
+			EXPECT_EQ(mesh.vertexNormals, normals ? expected.vertexNormals : std::vector<glm::vec3>()) << mesh.name;
+			EXPECT_EQ(mesh.vertexIndexes, faces ? expected.vertexIndexes : none) << mesh.name;
+			EXPECT_EQ(mesh.vertexTextureCoordinatesIndexes, faces && textureCoordinates ? expected.vertexTextureCoordinatesIndexes : none) << mesh.name;
+			EXPECT_EQ(mesh.vertexNormalsIndexes, faces && normals ? expected.vertexNormalsIndexes : none) << mesh.name;
+		}
+	}
+
+	// counts what it is called for, nothing more
+	struct CountingHandler {
+		size_t objects = 0;
+		size_t vertices = 0;
+		size_t normals = 0;
+		size_t textureCoordinates = 0;
+		size_t faces = 0;
+		size_t libraries = 0;
+
+		objParser::Error onObject(std::string_view) { objects++; return objParser::ErrorType::OK; }
+		objParser::Error onVertex(float, float, float, float) { vertices++; return objParser::ErrorType::OK; }
+		objParser::Error onNormal(float, float, float) { normals++; return objParser::ErrorType::OK; }
+		objParser::Error onTexCoord(float, float, float) { textureCoordinates++; return objParser::ErrorType::OK; }
+		objParser::Error onFace(const objParser::FaceCorners&) { faces++; return objParser::ErrorType::OK; }
+		objParser::Error onUseMtl(std::string_view) { return objParser::ErrorType::OK; }
+		objParser::Error onMtlLib(std::string_view) { libraries++; return objParser::ErrorType::OK; }
+	};
+}
+
+TEST(ObjParserAttributeMask, positionsOnlyFillsVertices) {
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::fan;
+	options.attributes = objParser::Attributes::positions;
+
+	// the mtllib is skipped too, so the missing file isnt an error
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	objParser::Error error = objParser::parseObjBuffer(attributeMaskTestObj, "", meshs, materials, options);
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	EXPECT_TRUE(materials.empty());
+	ASSERT_EQ(meshs.size(), 2);
+
+	EXPECT_EQ(meshs[0].vertices.size(), 4);
+	EXPECT_EQ(meshs[1].vertices.size(), 3);
+	for (const objParser::Mesh& mesh : meshs) {
+		EXPECT_TRUE(mesh.vertexTextureCoordinates.empty());
+		EXPECT_TRUE(mesh.vertexNormals.empty());
+		EXPECT_TRUE(mesh.vertexIndexes.empty());
+		EXPECT_TRUE(mesh.materialRanges.empty());
+	}
+}
+
+TEST(ObjParserAttributeMask, skippedLinesArentChecked) {
+	const std::string obj =
+		"o a\n"
+		"v 1 2 3\n"
+		"vn not a normal\n"
+		"vt\n"
+		"f 1/a 2//b\n";
+
+	objParser::ParseOptions options;
+	std::vector<objParser::Mesh> meshs;
+	EXPECT_EQ(AttributeMaskTestHelpers::parse(obj, meshs, options), objParser::ErrorType::FileFormatError);
+
+	options.attributes = objParser::Attributes::positions;
+	meshs.clear();
+	objParser::Error error = AttributeMaskTestHelpers::parse(obj, meshs, options);
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	ASSERT_EQ(meshs.size(), 1);
+	EXPECT_EQ(meshs[0].vertices, std::vector<glm::vec3>({ glm::vec3(1, 2, 3) }));
+}
+
+TEST(ObjParserAttributeMask, facesWithoutNormalsDropTheirNormalIndices) {
+	// the vn lines are skipped, so the normal indices would all be out of range if they were checked
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::fan;
+	options.attributes = objParser::Attributes::faces | objParser::Attributes::textureCoordinates;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	objParser::Error error = objParser::parseObjBuffer(attributeMaskTestObj.substr(attributeMaskTestObj.find("o a")), "", meshs, materials, options);
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	ASSERT_EQ(meshs.size(), 2);
+
+	// faces read the positions they point at even though they werent asked for
+	EXPECT_EQ(meshs[0].vertices.size(), 4);
+	EXPECT_EQ(meshs[0].vertexIndexes, std::vector<objParser::Index>({ 0, 1, 2, 0, 2, 3 }));
+	EXPECT_EQ(meshs[0].vertexTextureCoordinatesIndexes, std::vector<objParser::Index>({ 0, 1, 0, 0, 0, 1 }));
+	EXPECT_TRUE(meshs[0].vertexNormalsIndexes.empty());
+	EXPECT_EQ(meshs[1].vertexIndexes, std::vector<objParser::Index>({ 0, 1, 2, 2, 1, 0 }));
+	EXPECT_TRUE(meshs[1].vertexNormalsIndexes.empty());
+}
+
+TEST(ObjParserAttributeMask, everyParseGivesTheSameMeshs) {
+	std::string obj = AttributeMaskTestHelpers::makeObj();
+
+	objParser::ParseOptions fullOptions;
+	fullOptions.triangulation = objParser::Triangulation::earClipping;
+	std::vector<objParser::Mesh> full;
+	ASSERT_EQ(AttributeMaskTestHelpers::parse(obj, full, fullOptions), objParser::ErrorType::OK);
+
+	const objParser::Attributes masks[] = {
+		objParser::Attributes::positions,
+		objParser::Attributes::normals,
+		objParser::Attributes::positions | objParser::Attributes::faces,
+		objParser::Attributes::faces | objParser::Attributes::normals,
+		objParser::Attributes::textureCoordinates | objParser::Attributes::normals,
+		objParser::Attributes::none
+	};
+
+	for (objParser::Attributes attributes : masks) {
+		SCOPED_TRACE(static_cast<int>(attributes));
+
+		objParser::ParseOptions options = fullOptions;
+		options.attributes = attributes;
+
+		std::vector<objParser::Mesh> serial;
+		ASSERT_EQ(AttributeMaskTestHelpers::parse(obj, serial, options), objParser::ErrorType::OK);
+		AttributeMaskTestHelpers::expectMasked(serial, full, attributes);
+
+		std::vector<objParser::Mesh> streamed;
+		std::vector<objParser::Material> materials;
+		std::istringstream stream(obj);
+		ASSERT_EQ(objParser::parseObjStream(stream, "", streamed, materials, options), objParser::ErrorType::OK);
+		AttributeMaskTestHelpers::expectMasked(streamed, full, attributes);
+
+		objParser::ParseOptions threadedOptions = options;
+		threadedOptions.threadCount = 4;
+		threadedOptions.minimumChunkSize = 1;
+		threadedOptions.reserveExact = true;
+		std::vector<objParser::Mesh> threaded;
+		ASSERT_EQ(AttributeMaskTestHelpers::parse(obj, threaded, threadedOptions), objParser::ErrorType::OK);
+		AttributeMaskTestHelpers::expectMasked(threaded, full, attributes);
+
+		// reserving only counts what is read
+		for (const objParser::Mesh& mesh : threaded) {
+			EXPECT_EQ(mesh.vertexNormals.capacity(), mesh.vertexNormals.size()) << mesh.name;
+			EXPECT_EQ(mesh.vertexNormalsIndexes.capacity(), mesh.vertexNormalsIndexes.size()) << mesh.name;
+		}
+	}
+}
+
+TEST(ObjParserAttributeMask, eventParserOnlyCallsWhatIsRead) {
+	AttributeMaskTestHelpers::CountingHandler all;
+	ASSERT_EQ(objParser::parseObj(attributeMaskTestObj, all), objParser::ErrorType::OK);
+	EXPECT_EQ(all.vertices, 7);
+	EXPECT_EQ(all.textureCoordinates, 2);
+	EXPECT_EQ(all.normals, 2);
+	EXPECT_EQ(all.faces, 3);
+	EXPECT_EQ(all.libraries, 1);
+
+	AttributeMaskTestHelpers::CountingHandler positions;
+	ASSERT_EQ(objParser::parseObj<objParser::Attributes::positions>(attributeMaskTestObj, positions), objParser::ErrorType::OK);
+	EXPECT_EQ(positions.objects, 2);
+	EXPECT_EQ(positions.vertices, 7);
+	EXPECT_EQ(positions.textureCoordinates, 0);
+	EXPECT_EQ(positions.normals, 0);
+	EXPECT_EQ(positions.faces, 0);
+	EXPECT_EQ(positions.libraries, 0);
+}
\ No newline at end of file
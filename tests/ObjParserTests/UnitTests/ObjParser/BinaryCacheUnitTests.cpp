@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace BinaryCacheTestHelpers {
+	const std::string contents =
+		"mtllib mtlTest3_1.mtl\n"
+		"o first\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 1\nvn 0 0 1\n"
+		"f 1/1/1 2/2/1 3/1/1\nusemtl t2\nf 1/1/1 3/2/1 4/1/1\n"
+		"o second\nv 5 5 5\nv 6 5 5\nv 6 6 5\nf 1 2 3\n";
+
+	inline std::filesystem::path cachePath(std::string_view name) {
+		return std::filesystem::temp_directory_path() / ("objParserBinaryCache_" + std::string(name) + ".bin");
+	}
+
+	inline void parse(std::vector<objParser::Mesh>& meshs, std::vector<objParser::Material>& materials, objParser::AttributeLayout layout = objParser::AttributeLayout::arrayOfStructs) {
+		objParser::ParseOptions options;
+		options.layout = layout;
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "../tests/TestAssets", meshs, materials, options), objParser::ErrorType::OK);
+	}
+
+	inline void expectSameArrays(const objParser::AttributeArrays& loaded, const objParser::AttributeArrays& expected) {
+		EXPECT_EQ(loaded.xs, expected.xs);
+		EXPECT_EQ(loaded.ys, expected.ys);
+		EXPECT_EQ(loaded.zs, expected.zs);
+	}
+
+	inline void expectSame(const objParser::Mesh& loaded, const objParser::Mesh& expected) {
+		EXPECT_EQ(loaded.name, expected.name);
+		EXPECT_EQ(loaded.mtlIndex, expected.mtlIndex);
+		EXPECT_EQ(loaded.vertices, expected.vertices);
+		EXPECT_EQ(loaded.vertexTextureCoordinates, expected.vertexTextureCoordinates);
+		EXPECT_EQ(loaded.vertexNormals, expected.vertexNormals);
+		expectSameArrays(loaded.vertexArrays, expected.vertexArrays);
+		expectSameArrays(loaded.vertexTextureCoordinateArrays, expected.vertexTextureCoordinateArrays);
+		expectSameArrays(loaded.vertexNormalArrays, expected.vertexNormalArrays);
+		EXPECT_EQ(loaded.vertexIndexes, expected.vertexIndexes);
+		EXPECT_EQ(loaded.vertexTextureCoordinatesIndexes, expected.vertexTextureCoordinatesIndexes);
+		EXPECT_EQ(loaded.vertexNormalsIndexes, expected.vertexNormalsIndexes);
+		EXPECT_EQ(loaded.materialRanges, expected.materialRanges);
+	}
+
+	inline void flipByte(const std::filesystem::path& path, std::streamoff offset) {
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekg(offset);
+		char byte = static_cast<char>(file.get());
+		file.seekp(offset);
+		file.put(static_cast<char>(byte ^ 0x40));
+	}
+}
+
+TEST(BinaryCache, roundTripsAParse) {
+	for (objParser::AttributeLayout layout : { objParser::AttributeLayout::arrayOfStructs, objParser::AttributeLayout::structOfArrays }) {
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+		BinaryCacheTestHelpers::parse(meshs, materials, layout);
+		ASSERT_EQ(meshs.size(), 2);
+		ASSERT_FALSE(materials.empty());
+
+		std::filesystem::path path = BinaryCacheTestHelpers::cachePath("roundTrip");
+		ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+
+		std::vector<objParser::Mesh> loadedMeshs;
+		std::vector<objParser::Material> loadedMaterials;
+		ASSERT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::OK);
+
+		ASSERT_EQ(loadedMeshs.size(), meshs.size());
+		BinaryCacheTestHelpers::expectSame(loadedMeshs.at(0), meshs.at(0));
+		BinaryCacheTestHelpers::expectSame(loadedMeshs.at(1), meshs.at(1));
+
+		ASSERT_EQ(loadedMaterials.size(), materials.size());
+		for (size_t i = 0; i < materials.size(); i++) {
+			EXPECT_EQ(loadedMaterials[i].name, materials[i].name);
+			EXPECT_EQ(loadedMaterials[i].diffuseColor, materials[i].diffuseColor);
+			EXPECT_EQ(loadedMaterials[i].specularExponent, materials[i].specularExponent);
+			EXPECT_EQ(loadedMaterials[i].indexOfRefraction, materials[i].indexOfRefraction);
+		}
+
+		std::filesystem::remove(path);
+	}
+}
+
+TEST(BinaryCache, readsInPlace) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	BinaryCacheTestHelpers::parse(meshs, materials);
+
+	std::filesystem::path path = BinaryCacheTestHelpers::cachePath("inPlace");
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+
+	objParser::BinaryCache cache;
+	ASSERT_EQ(cache.open(path), objParser::ErrorType::OK);
+	ASSERT_EQ(cache.meshCount(), 2);
+	ASSERT_EQ(cache.materialCount(), materials.size());
+
+	objParser::CachedMesh first = cache.mesh(0);
+	EXPECT_EQ(first.name, "first");
+	EXPECT_EQ(first.vertexCount(), 4);
+	EXPECT_TRUE(std::ranges::equal(first.vertices, meshs.at(0).vertices));
+	EXPECT_TRUE(std::ranges::equal(first.vertexIndexes, meshs.at(0).vertexIndexes));
+	EXPECT_TRUE(std::ranges::equal(first.materialRanges, meshs.at(0).materialRanges));
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(first.vertices.data()) % 16, 0);
+
+	EXPECT_EQ(cache.material(0).name, materials.at(0).name);
+
+	cache.close();
+	EXPECT_FALSE(cache.isOpen());
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryCache, appendsAfterWhatIsThere) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	BinaryCacheTestHelpers::parse(meshs, materials);
+
+	std::filesystem::path path = BinaryCacheTestHelpers::cachePath("appends");
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+
+	// loading twice gives two copies, the second one pointing at its own materials
+	std::vector<objParser::Mesh> loadedMeshs;
+	std::vector<objParser::Material> loadedMaterials;
+	ASSERT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::OK);
+
+	ASSERT_EQ(loadedMeshs.size(), 4);
+	ASSERT_EQ(loadedMaterials.size(), 2 * materials.size());
+	EXPECT_EQ(loadedMeshs.at(2).mtlIndex, meshs.at(0).mtlIndex + materials.size());
+	ASSERT_EQ(loadedMeshs.at(2).materialRanges.size(), 1);
+	EXPECT_EQ(loadedMeshs.at(2).materialRanges.at(0).mtlIndex, meshs.at(0).materialRanges.at(0).mtlIndex + materials.size());
+
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryCache, keepsMeshsWithoutAMaterial) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	BinaryCacheTestHelpers::parse(meshs, materials);
+
+	// second never has a usemtl
+	ASSERT_EQ(meshs.at(1).mtlIndex, objParser::noMaterial);
+
+	// the same meshs always give the same bytes
+	std::filesystem::path path = BinaryCacheTestHelpers::cachePath("noMaterial");
+	std::filesystem::path againPath = BinaryCacheTestHelpers::cachePath("noMaterialAgain");
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::saveBinaryCache(againPath, meshs, materials), objParser::ErrorType::OK);
+
+	auto readAll = [](const std::filesystem::path& file) {
+		std::ifstream stream(file, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+	};
+	EXPECT_EQ(readAll(path), readAll(againPath));
+
+	// loaded after other materials it still has none, instead of being moved along with the ones that do
+	std::vector<objParser::Mesh> loadedMeshs;
+	std::vector<objParser::Material> loadedMaterials;
+	ASSERT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::OK);
+
+	ASSERT_EQ(loadedMeshs.size(), 4);
+	EXPECT_EQ(loadedMeshs.at(1).mtlIndex, objParser::noMaterial);
+	EXPECT_EQ(loadedMeshs.at(3).mtlIndex, objParser::noMaterial);
+
+	objParser::BinaryCache cache;
+	ASSERT_EQ(cache.open(path, {}), objParser::ErrorType::OK);
+	EXPECT_EQ(cache.mesh(1).mtlIndex, objParser::noMaterial);
+	cache.close();
+
+	std::filesystem::remove(path);
+	std::filesystem::remove(againPath);
+}
+
+TEST(BinaryCache, rejectsBadFiles) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	BinaryCacheTestHelpers::parse(meshs, materials);
+
+	std::filesystem::path path = BinaryCacheTestHelpers::cachePath("bad");
+	std::vector<objParser::Mesh> loadedMeshs;
+	std::vector<objParser::Material> loadedMaterials;
+
+	EXPECT_EQ(objParser::loadBinaryCache(BinaryCacheTestHelpers::cachePath("missing"), loadedMeshs, loadedMaterials), objParser::ErrorType::FileNotFound);
+
+	// a damaged array is caught by the checksum, unless it is skipped
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+	BinaryCacheTestHelpers::flipByte(path, static_cast<std::streamoff>(std::filesystem::file_size(path)) - 20);
+	EXPECT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::FileFormatError);
+
+	objParser::BinaryCache cache;
+	EXPECT_EQ(cache.open(path, {}, false), objParser::ErrorType::OK);
+	cache.close();
+
+	// so is a damaged header
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+	BinaryCacheTestHelpers::flipByte(path, 8);
+	EXPECT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::FileFormatError);
+
+	// and a cut off file
+	ASSERT_EQ(objParser::saveBinaryCache(path, meshs, materials), objParser::ErrorType::OK);
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 16);
+	EXPECT_EQ(objParser::loadBinaryCache(path, loadedMeshs, loadedMaterials), objParser::ErrorType::FileFormatError);
+
+	// and anything that isnt a cache
+	EXPECT_EQ(objParser::loadBinaryCache("../tests/TestAssets/objTest1.obj", loadedMeshs, loadedMaterials), objParser::ErrorType::FileFormatError);
+
+	EXPECT_TRUE(loadedMeshs.empty());
+	EXPECT_TRUE(loadedMaterials.empty());
+	std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string_view>
+#include <cstring>
+
+constexpr std::string_view bufferTestObj =
+	"o t\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"vt 1 0 0.5\n"
+	"vn 0 1 0\n"
+	"\n"
+	"f 1/1/1 2/1/1 3/1/1\n"
+	"f 3/1/1 2/1/1 1/1/1";
+
+TEST(ObjParserBufferParse, matchesStream) {
+	std::vector<objParser::Mesh> bufferMeshs;
+	std::vector<objParser::Mesh> streamMeshs;
+	std::vector<objParser::Material> materials;
+
+	std::istringstream stream{ std::string(bufferTestObj) };
+
+	ASSERT_EQ(objParser::parseObjBuffer(bufferTestObj, "", bufferMeshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::parseObjStream(stream, "", streamMeshs, materials), objParser::ErrorType::OK);
+
+	ASSERT_EQ(bufferMeshs.size(), 1);
+	ASSERT_EQ(streamMeshs.size(), 1);
+
+	EXPECT_EQ(bufferMeshs.at(0).name, streamMeshs.at(0).name);
+	EXPECT_EQ(bufferMeshs.at(0).vertices, streamMeshs.at(0).vertices);
+	EXPECT_EQ(bufferMeshs.at(0).vertexTextureCoordinates, streamMeshs.at(0).vertexTextureCoordinates);
+	EXPECT_EQ(bufferMeshs.at(0).vertexNormals, streamMeshs.at(0).vertexNormals);
+	EXPECT_EQ(bufferMeshs.at(0).vertexIndexes, streamMeshs.at(0).vertexIndexes);
+	EXPECT_EQ(bufferMeshs.at(0).vertexTextureCoordinatesIndexes, streamMeshs.at(0).vertexTextureCoordinatesIndexes);
+	EXPECT_EQ(bufferMeshs.at(0).vertexNormalsIndexes, streamMeshs.at(0).vertexNormalsIndexes);
+}
+
+TEST(ObjParserBufferParse, acceptsByteSpan) {
+	std::vector<std::byte> bytes(bufferTestObj.size());
+	std::memcpy(bytes.data(), bufferTestObj.data(), bufferTestObj.size());
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer(std::span<const std::byte>(bytes), "", meshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 1);
+
+	EXPECT_EQ(meshs.at(0).vertices, std::vector<glm::vec3>({ { 1,2,3 }, { 4,5,6 }, { 7,8,9 } }));
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0,1,2,2,1,0 }));
+}
+
+TEST(ObjParserBufferParse, stopsAtBufferEnd) {
+	// only the first two lines are inside the view, the third must never be read
+	constexpr std::string_view contents = "o t\nv 1 2 3\nv a b c";
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents.substr(0, 11), "", meshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 1);
+	EXPECT_EQ(meshs.at(0).vertices.size(), 1);
+}
+
+TEST(ObjParserBufferParse, reportsErrors) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	EXPECT_EQ(objParser::parseObjBuffer("v 1 2 3", "", meshs, materials), objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(objParser::parseObjBuffer("o t\nx 1 2 3", "", meshs, materials), objParser::ErrorType::FileFormatError);
+}
+
+TEST(MtlParserBufferParse, parsesMaterials) {
+	constexpr std::string_view contents =
+		"newmtl t1\n"
+		"Ka 0.0 .3 1.0\n"
+		"\n"
+		"newmtl t2\n"
+		"Kd 1.0 0.0 1.0\n"
+		"Ns 10";
+
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseMtlBuffer(contents, "", materials), objParser::ErrorType::OK);
+	ASSERT_EQ(materials.size(), 2);
+
+	EXPECT_EQ(materials.at(0).name, "t1");
+	EXPECT_EQ(materials.at(0).ambientColor, glm::vec3(0.0f, 0.3f, 1.0f));
+	EXPECT_EQ(materials.at(1).name, "t2");
+	EXPECT_EQ(materials.at(1).diffuseColor, glm::vec3(1.0f, 0.0f, 1.0f));
+	EXPECT_EQ(materials.at(1).specularExponent, 10.0f);
+
+	EXPECT_EQ(objParser::parseMtlBuffer(std::string_view("Ka 2 2 2"), "", materials), objParser::ErrorType::FileFormatError);
+}
+
+TEST(ObjParserBufferParse, dispatchesOnWholeKeyword) {
+	const std::vector<std::pair<std::string, objParser::ErrorType>> cases = {
+		{ "o t\nv 1 2 3", objParser::ErrorType::OK },
+		{ "o t\nvn 1 2 3", objParser::ErrorType::OK },
+		{ "o t\nvt 1 2 3", objParser::ErrorType::OK },
+		{ "o t\n# a comment", objParser::ErrorType::OK },
+		{ "o t\n   \t", objParser::ErrorType::OK },
+
+		// keywords that share a first byte with a real one
+		{ "o t\nvx 1 2 3", objParser::ErrorType::FileFormatError },
+		{ "o t\nvnn 1 2 3", objParser::ErrorType::FileFormatError },
+		{ "o t\nff 1 2 3", objParser::ErrorType::FileFormatError },
+		{ "o t\noo t", objParser::ErrorType::FileFormatError },
+		{ "o t\n#comment", objParser::ErrorType::FileFormatError },
+		{ "o t\nusemtlx t", objParser::ErrorType::FileFormatError },
+		{ "o t\nmtl t", objParser::ErrorType::FileFormatError },
+		{ "o t\nx 1 2 3", objParser::ErrorType::FileFormatError },
+	};
+
+	for (const auto& [contents, expectedError] : cases) {
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+
+		EXPECT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), expectedError) << contents;
+	}
+}
+
+TEST(MtlParserBufferParse, dispatchesOnWholeKeyword) {
+	constexpr std::string_view contents =
+		"newmtl t\n"
+		"Kaa 2 2 2\n"
+		"K 2 2 2\n"
+		"ka 2 2 2\n"
+		"map_Ka texture.png\n"
+		"map_bump bump.png\n"
+		"illum 2\n"
+		"newmtlx t2\n"
+		"Ks 0.5 0.5 0.5\n"
+		"Tf 0.25 0.25 0.25\n"
+		"unknownkeyword 1";
+
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseMtlBuffer(contents, "", materials), objParser::ErrorType::OK);
+	ASSERT_EQ(materials.size(), 1);
+
+	EXPECT_EQ(materials.at(0).ambientColor, glm::vec3(0.0f));
+	EXPECT_EQ(materials.at(0).specularColor, glm::vec3(0.5f));
+	EXPECT_EQ(materials.at(0).transmissionFilter, glm::vec3(0.25f));
+}
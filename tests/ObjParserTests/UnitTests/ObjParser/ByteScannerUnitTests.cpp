@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+// every instruction set has to find exactly what the plain loops find
+
+namespace ByteScannerTestHelpers {
+	inline std::string makeRandomText(size_t length, uint32_t seed) {
+		// mostly digits and letters, with the bytes the scanners look for sprinkled in
+		constexpr std::string_view alphabet = "0123456789.-abcvfn    \t\t//##\n\n\r";
+
+		std::mt19937 rng(seed);
+		std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+		std::uniform_int_distribution<int> sparse(0, 9);
+
+		std::string text(length, 'x');
+		for (char& c : text) {
+			// leave long runs with nothing to find, so the wide loops get to skip whole blocks
+			c = sparse(rng) == 0 ? alphabet[pick(rng)] : '7';
+		}
+		return text;
+	}
+
+	inline const char* referenceFindNewline(const char* begin, const char* end) {
+		while (begin != end && *begin != '\n') {
+			begin++;
+		}
+		return begin;
+	}
+
+	// puts the level back how it was when the test is done
+	struct ScopedSimdLevel {
+		objParser::SimdLevel previous;
+
+		ScopedSimdLevel(objParser::SimdLevel level) : previous(objParser::activeSimdLevel()) {
+			objParser::setSimdLevel(level);
+		}
+
+		~ScopedSimdLevel() {
+			objParser::setSimdLevel(previous);
+		}
+	};
+}
+
+TEST(ByteScanner, everyLevelMatchesScalar) {
+	const std::vector<objParser::SimdLevel> levels = { objParser::SimdLevel::scalar, objParser::SimdLevel::sse2, objParser::SimdLevel::avx2, objParser::SimdLevel::avx512 };
+
+	for (objParser::SimdLevel level : levels) {
+		ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(level);
+
+		if (objParser::activeSimdLevel() != level) {
+			// this cpu cant run it
+			continue;
+		}
+
+		for (size_t length : { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 200, 4099 }) {
+			std::string text = ByteScannerTestHelpers::makeRandomText(length + 3, static_cast<uint32_t>(length));
+
+			// unaligned starts too
+			for (size_t offset = 0; offset < 3; offset++) {
+				const char* begin = text.data() + offset;
+				const char* end = begin + length;
+
+				for (const char* it = begin; it <= end; it++) {
+					ASSERT_EQ(objParser::findNewline(it, end), ByteScannerTestHelpers::referenceFindNewline(it, end)) << level << " length " << length;
+				}
+			}
+		}
+	}
+}
+
+TEST(ByteScanner, lineSplitterMatchesFindNewline) {
+	const std::vector<objParser::SimdLevel> levels = { objParser::SimdLevel::scalar, objParser::SimdLevel::sse2, objParser::SimdLevel::avx2, objParser::SimdLevel::avx512 };
+
+	for (objParser::SimdLevel level : levels) {
+		ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(level);
+
+		if (objParser::activeSimdLevel() != level) {
+			continue;
+		}
+
+		for (size_t length : { 0, 1, 2, 63, 64, 65, 127, 128, 129, 4099 }) {
+			std::string text = ByteScannerTestHelpers::makeRandomText(length, static_cast<uint32_t>(length) + 7);
+
+			// a newline right on the end and right at the start of a block are the awkward ones
+			for (bool newlineAtEnd : { false, true }) {
+				if (newlineAtEnd && length > 0) {
+					text.back() = '\n';
+				}
+
+				std::vector<std::string_view> expected;
+				const char* end = text.data() + text.size();
+				for (const char* it = text.data(); it < end;) {
+					const char* lineEnd = ByteScannerTestHelpers::referenceFindNewline(it, end);
+					expected.emplace_back(it, lineEnd - it);
+					it = lineEnd + 1;
+				}
+
+				std::vector<std::string_view> lines;
+				objParser::LineSplitter splitter(text);
+				std::string_view line;
+				while (splitter.next(line)) {
+					lines.push_back(line);
+				}
+
+				ASSERT_EQ(lines, expected) << level << " length " << length;
+			}
+		}
+	}
+}
+
+TEST(ByteScanner, clampsToDetectedLevel) {
+	ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(objParser::SimdLevel::avx512);
+
+	EXPECT_LE(objParser::activeSimdLevel(), objParser::detectedSimdLevel());
+}
+
+TEST(ByteScanner, parsesTheSameAtEveryLevel) {
+	std::string contents = "o t\n";
+	for (int i = 0; i < 200; i++) {
+		contents += "v " + std::to_string(i) + " 0.5 -1\n";
+	}
+	contents += "f 1 2 3\nf -1 -2 -3";
+
+	std::vector<objParser::Mesh> expectedMeshs;
+	std::vector<objParser::Material> materials;
+	{
+		ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(objParser::SimdLevel::scalar);
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "", expectedMeshs, materials), objParser::ErrorType::OK);
+	}
+
+	std::vector<objParser::Mesh> meshs;
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+
+	ASSERT_EQ(meshs.size(), 1);
+	EXPECT_EQ(meshs.at(0).vertices, expectedMeshs.at(0).vertices);
+	EXPECT_EQ(meshs.at(0).vertexIndexes, expectedMeshs.at(0).vertexIndexes);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace EventParserTestHelpers {
+	// writes every event down as a line, so a test can compare the whole sequence at once
+	struct RecordingHandler {
+		std::ostringstream events;
+
+		objParser::Error onObject(std::string_view name) {
+			events << "o " << name << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onVertex(float x, float y, float z, float w) {
+			events << "v " << x << " " << y << " " << z << " " << w << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onNormal(float x, float y, float z) {
+			events << "vn " << x << " " << y << " " << z << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onTexCoord(float u, float v, float w) {
+			events << "vt " << u << " " << v << " " << w << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onFace(const objParser::FaceCorners& corners) {
+			events << "f";
+			for (const objParser::FaceCorner& corner : corners) {
+				events << " " << corner.v << "/" << corner.vt << "/" << corner.vn;
+			}
+			events << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onUseMtl(std::string_view name) {
+			events << "usemtl " << name << "\n";
+			return objParser::ErrorType::OK;
+		}
+
+		objParser::Error onMtlLib(std::string_view name) {
+			events << "mtllib " << name << "\n";
+			return objParser::ErrorType::OK;
+		}
+	};
+
+	// fails on the second vertex
+	struct FailingHandler : RecordingHandler {
+		size_t vertices = 0;
+
+		objParser::Error onVertex(float x, float y, float z, float w) {
+			vertices++;
+			if (vertices == 2) {
+				return objParser::Error(objParser::ErrorType::FileFormatError, "stop");
+			}
+			return RecordingHandler::onVertex(x, y, z, w);
+		}
+	};
+}
+
+TEST(EventParser, callsTheHandlerForEveryStatement) {
+	const std::string obj =
+		"mtllib a.mtl\n"
+		"# a comment\n"
+		"o cube\n"
+		"v 1 2 3\n"
+		"v 2 4 6 2\n"
+		"vn 0 0 5\n"
+		"vt 0.5\n"
+		"usemtl red\n"
+		"f 1//1 2//1 -1//1\n";
+
+	EventParserTestHelpers::RecordingHandler handler;
+	objParser::Error error = objParser::parseObj(std::string_view(obj), handler);
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	EXPECT_EQ(handler.events.str(),
+		"mtllib a.mtl\n"
+		"o cube\n"
+		"v 1 2 3 1\n"
+		"v 2 4 6 2\n"
+		"vn 0 0 5\n"
+		"vt 0.5 0 0\n"
+		"usemtl red\n"
+		"f 1/0/1 2/0/1 -1/0/1\n");
+}
+
+TEST(EventParser, iteratesEveryCornerOfAPolygon) {
+	const std::string obj = "f 1/1 2/2 3/3 4/4 5/5 6/6 -7/-7\n";
+
+	EventParserTestHelpers::RecordingHandler handler;
+	objParser::Error error = objParser::parseObj(std::string_view(obj), handler);
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	EXPECT_EQ(handler.events.str(), "f 1/1/0 2/2/0 3/3/0 4/4/0 5/5/0 6/6/0 -7/-7/0\n");
+}
+
+TEST(EventParser, streamAndBufferGiveTheSameEvents) {
+	std::string obj = "o big\n";
+	for (int i = 0; i < 5000; i++) {
+		obj += "v " + std::to_string(i) + " 1 2\n";
+		obj += "f 1 2 3 4 " + std::to_string(i + 1) + "\n";
+	}
+
+	EventParserTestHelpers::RecordingHandler bufferHandler;
+	ASSERT_EQ(objParser::parseObj(std::string_view(obj), bufferHandler), objParser::ErrorType::OK);
+
+	std::istringstream stream(obj);
+	EventParserTestHelpers::RecordingHandler streamHandler;
+	ASSERT_EQ(objParser::parseObj(stream, streamHandler), objParser::ErrorType::OK);
+
+	EXPECT_EQ(bufferHandler.events.str(), streamHandler.events.str());
+}
+
+TEST(EventParser, stopsAtABadLine) {
+	const std::string obj =
+		"v 1 2 3\n"
+		"f 1/1 2//2 3/3\n"
+		"v 4 5 6\n";
+
+	EventParserTestHelpers::RecordingHandler handler;
+	objParser::Error error = objParser::parseObj(std::string_view(obj), handler);
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(handler.events.str(), "v 1 2 3 1\n");
+}
+
+TEST(EventParser, rejectsUnknownStatements) {
+	EventParserTestHelpers::RecordingHandler handler;
+	objParser::Error error = objParser::parseObj(std::string_view("s off\n"), handler);
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(handler.events.str(), "");
+}
+
+TEST(EventParser, stopsWhenTheHandlerFails) {
+	const std::string obj =
+		"v 1 2 3\n"
+		"v 4 5 6\n"
+		"o never\n";
+
+	EventParserTestHelpers::FailingHandler handler;
+	objParser::Error error = objParser::parseObj(std::string_view(obj), handler);
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(error.message, "stop");
+	EXPECT_EQ(handler.events.str(), "v 1 2 3 1\n");
+}
+
+TEST(EventParser, resolvesIndicesLikeTheMeshParse) {
+	int64_t index = 3;
+	EXPECT_TRUE(objParser::resolveFaceIndex(index, 3));
+	EXPECT_EQ(index, 2);
+
+	index = -3;
+	EXPECT_TRUE(objParser::resolveFaceIndex(index, 3));
+	EXPECT_EQ(index, 0);
+
+	index = 4;
+	EXPECT_FALSE(objParser::resolveFaceIndex(index, 3));
+
+	index = -4;
+	EXPECT_FALSE(objParser::resolveFaceIndex(index, 3));
+}
+
+TEST(EventParser, meshParseStillMatches) {
+	const std::string obj =
+		"o quad\n"
+		"v 0 0 0\n"
+		"v 1 0 0 2\n"
+		"v 1 1 0\n"
+		"v 0 1 0\n"
+		"vn 0 0 3\n"
+		"f 1//1 2//1 3//1 4//1\n";
+
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::fan;
+
+	objParser::Vector<objParser::Mesh> meshs;
+	objParser::Vector<objParser::Material> materials;
+	std::istringstream stream(obj);
+	objParser::Error error = objParser::parseObjStream(stream, "", meshs, materials, options);
+
+	ASSERT_EQ(error, objParser::ErrorType::OK) << error.message;
+	ASSERT_EQ(meshs.size(), 1);
+	EXPECT_EQ(meshs[0].vertices[1], glm::vec3(0.5f, 0, 0));
+	EXPECT_EQ(meshs[0].vertexNormals[0], glm::vec3(0, 0, 1));
+	EXPECT_EQ(meshs[0].vertexIndexes, objParser::Vector<objParser::Index>({ 0, 1, 2, 0, 2, 3 }));
+	EXPECT_EQ(meshs[0].vertexNormalsIndexes, objParser::Vector<objParser::Index>({ 0, 0, 0, 0, 0, 0 }));
+}
\ No newline at end of file
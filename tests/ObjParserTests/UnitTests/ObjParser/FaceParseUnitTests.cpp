@@ -108,6 +108,8 @@ INSTANTIATE_TEST_SUITE_P(
 
 		FaceParseCase{ "f -1 -1 -1",			true, 3, 0, 0, { 1, 1, 1 }, {},	{} },	// ACCEPTS negatives
 		FaceParseCase{ "f -2 -2 -2",			true, 3, 0, 0, { 0, 0, 0 }, {},	{} },	// ACCEPTS negatives
+		FaceParseCase{ "f -3 -3 -3",			true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS negatives, index before the start
+		FaceParseCase{ "f 1/-3 1/1 1/1",		true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS negatives, vert texture index before the start
 
 		FaceParseCase{ "f 3 3 3",				true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index out of range
 		FaceParseCase{ "f 3/3 3/3 3/3",			true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts and vert texture, index out of range
@@ -125,6 +127,9 @@ INSTANTIATE_TEST_SUITE_P(
 		FaceParseCase{ "f 0 1 2",				true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index equal to zero with some correct value
 		FaceParseCase{ "f 0/2 0/1 2/0",			true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index equal to zero with some correct value
 		FaceParseCase{ "f 2//0 0//1 0//2",		true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index equal to zero with some correct value
+
+		FaceParseCase{ "f 3000000000 1 1",		true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index past what an int can hold
+		FaceParseCase{ "f -3000000000 1 1",		true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, negative index past what an int can hold
 		FaceParseCase{ "f 2/0/1 0/1/0 0/0/2",	true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, index equal to zero with some correct value
 
 		FaceParseCase{ "f a 1 1",				true, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError },	// REJECTS verts, not an int
@@ -153,3 +158,19 @@ INSTANTIATE_TEST_SUITE_P(
 		FaceParseCase{ "f 1/1/1 1/1/1 1/1/1",		false, 0, 0, 0, {}, {}, {}, objParser::ErrorType::FileFormatError }	// REJECTS there are no meshs
 	)
 );
+
+TEST(FaceParse, checksEachIndexAgainstItsOwnList) {
+	// 3 verts but only 1 texture coord and 1 normal, so index 2 is only valid for the verts
+	constexpr std::string_view header = "o t\nv 0 0 0\nv 0 0 0\nv 0 0 0\nvt 0 0\nvn 0 0 1\n";
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer(std::string(header) + "f 1/1/1 2/1/1 3/1/1", "", meshs, materials), objParser::ErrorType::OK);
+
+	meshs.clear();
+	EXPECT_EQ(objParser::parseObjBuffer(std::string(header) + "f 1/1/1 2/2/1 3/1/1", "", meshs, materials), objParser::ErrorType::FileFormatError);
+
+	meshs.clear();
+	EXPECT_EQ(objParser::parseObjBuffer(std::string(header) + "f 1/1/1 2/1/2 3/1/1", "", meshs, materials), objParser::ErrorType::FileFormatError);
+}
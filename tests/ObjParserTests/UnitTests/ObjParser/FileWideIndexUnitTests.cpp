@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace FileWideIndexTestHelpers {
+	// the shared pool comes first, then two objects that both use parts of it, the second one reaching back past the first
+	const std::string sharedPool =
+		"v 0 0 0\nv 1 0 0\nv 2 0 0\nv 3 0 0\nvn 0 0 1\nvn 0 1 0\n"
+		"o first\nf 2//1 3//1 4//1\n"
+		"o second\nv 4 0 0\nf 1//2 -1//2 3//1\n";
+
+	inline objParser::ParseOptions fileWideOptions() {
+		objParser::ParseOptions options;
+		options.faceIndexing = objParser::FaceIndexing::fileWide;
+		return options;
+	}
+}
+
+TEST(FileWideIndex, sharesAttributesAcrossObjects) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer(FileWideIndexTestHelpers::sharedPool, "", meshs, materials, FileWideIndexTestHelpers::fileWideOptions()), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 2);
+
+	// each mesh only gets what its faces use, in file order
+	EXPECT_EQ(meshs.at(0).vertices, std::vector<glm::vec3>({ { 1, 0, 0 }, { 2, 0, 0 }, { 3, 0, 0 } }));
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 1, 2 }));
+	EXPECT_EQ(meshs.at(0).vertexNormals, std::vector<glm::vec3>({ { 0, 0, 1 } }));
+	EXPECT_EQ(meshs.at(0).vertexNormalsIndexes, std::vector<int>({ 0, 0, 0 }));
+
+	EXPECT_EQ(meshs.at(1).vertices, std::vector<glm::vec3>({ { 0, 0, 0 }, { 2, 0, 0 }, { 4, 0, 0 } }));
+	EXPECT_EQ(meshs.at(1).vertexIndexes, std::vector<int>({ 0, 2, 1 }));
+	EXPECT_EQ(meshs.at(1).vertexNormals, std::vector<glm::vec3>({ { 0, 0, 1 }, { 0, 1, 0 } }));
+	EXPECT_EQ(meshs.at(1).vertexNormalsIndexes, std::vector<int>({ 1, 1, 0 }));
+}
+
+TEST(FileWideIndex, sameForEveryWayOfParsing) {
+	std::vector<objParser::Mesh> expected;
+	std::vector<objParser::Material> materials;
+	ASSERT_EQ(objParser::parseObjBuffer(FileWideIndexTestHelpers::sharedPool, "", expected, materials, FileWideIndexTestHelpers::fileWideOptions()), objParser::ErrorType::OK);
+
+	auto expectSame = [&expected](const std::vector<objParser::Mesh>& meshs) {
+		ASSERT_EQ(meshs.size(), expected.size());
+		for (size_t i = 0; i < meshs.size(); i++) {
+			EXPECT_EQ(meshs[i].vertexCount(), expected[i].vertexCount());
+			EXPECT_EQ(meshs[i].vertexIndexes, expected[i].vertexIndexes);
+			EXPECT_EQ(meshs[i].vertexNormalsIndexes, expected[i].vertexNormalsIndexes);
+		}
+	};
+
+	std::istringstream stream(FileWideIndexTestHelpers::sharedPool);
+	std::vector<objParser::Mesh> streamMeshs;
+	ASSERT_EQ(objParser::parseObjStream(stream, "", streamMeshs, materials, FileWideIndexTestHelpers::fileWideOptions()), objParser::ErrorType::OK);
+	expectSame(streamMeshs);
+	EXPECT_EQ(streamMeshs.at(1).vertices, expected.at(1).vertices);
+
+	objParser::ParseOptions options = FileWideIndexTestHelpers::fileWideOptions();
+	options.threadCount = 4;
+	options.minimumChunkSize = 1;
+	options.reserveExact = true;
+	std::vector<objParser::Mesh> threadedMeshs;
+	ASSERT_EQ(objParser::parseObjBuffer(FileWideIndexTestHelpers::sharedPool, "", threadedMeshs, materials, options), objParser::ErrorType::OK);
+	expectSame(threadedMeshs);
+	EXPECT_EQ(threadedMeshs.at(1).vertices, expected.at(1).vertices);
+
+	options.layout = objParser::AttributeLayout::structOfArrays;
+	std::vector<objParser::Mesh> soaMeshs;
+	ASSERT_EQ(objParser::parseObjBuffer(FileWideIndexTestHelpers::sharedPool, "", soaMeshs, materials, options), objParser::ErrorType::OK);
+	expectSame(soaMeshs);
+	EXPECT_EQ(soaMeshs.at(1).vertexArrays.xs, std::vector<float>({ 0, 2, 4 }));
+	EXPECT_TRUE(soaMeshs.at(1).vertices.empty());
+}
+
+TEST(FileWideIndex, carriesOnTheLastMesh) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	meshs.emplace_back("existing");
+	meshs.back().vertices = { { 9, 9, 9 } };
+	meshs.back().vertexIndexes = { 0, 0, 0 };
+
+	ASSERT_EQ(objParser::parseObjBuffer("v 5 0 0\nv 6 0 0\nv 7 0 0\nf 3 2 3", "", meshs, materials, FileWideIndexTestHelpers::fileWideOptions()), objParser::ErrorType::OK);
+
+	// what the mesh had is left alone, the face's vertices go after it
+	ASSERT_EQ(meshs.size(), 1);
+	EXPECT_EQ(meshs.at(0).vertices, std::vector<glm::vec3>({ { 9, 9, 9 }, { 6, 0, 0 }, { 7, 0, 0 } }));
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 0, 0, 2, 1, 2 }));
+}
+
+TEST(FileWideIndex, indicesStopAtTheEndOfThePool) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	objParser::Error error = objParser::parseObjBuffer("v 0 0 0\nv 0 0 0\no t\nv 0 0 0\nf 1 2 4", "", meshs, materials, FileWideIndexTestHelpers::fileWideOptions());
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(error.message, "Vertex '4' out of range. Expected less than '3'");
+
+	// a face still needs an object to go in
+	meshs.clear();
+	error = objParser::parseObjBuffer("v 0 0 0\nf 1 1 1", "", meshs, materials, FileWideIndexTestHelpers::fileWideOptions());
+	EXPECT_EQ(error.message, "Trying to read data before any objects have been defined");
+}
\ No newline at end of file
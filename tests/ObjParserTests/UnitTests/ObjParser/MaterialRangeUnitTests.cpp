@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace MaterialRangeTestHelpers {
+	inline std::vector<objParser::Material> makeMaterials() {
+		return { objParser::Material("a"), objParser::Material("b"), objParser::Material("c") };
+	}
+
+	// one vertex per face corner, so a face can be picked out of vertexIndexes by its first index
+	inline std::string makeObj(std::string_view body) {
+		std::string contents = "o t\n";
+		for (int i = 0; i < 30; i++) {
+			contents += "v 0 0 0\nvt 0 0\n";
+		}
+		return contents + std::string(body);
+	}
+}
+
+TEST(MaterialRange, recordsARangePerUsemtl) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials = MaterialRangeTestHelpers::makeMaterials();
+
+	std::string contents = MaterialRangeTestHelpers::makeObj(
+		"f 1 2 3\n"
+		"usemtl b\nf 4 5 6\nf 7 8 9\n"
+		"usemtl c\nusemtl a\nf 10 11 12\n"
+		"usemtl a\nf 13 14 15\n"
+		"usemtl b\nf 16 17 18\n"
+		"usemtl c\n");
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+
+	// the first face has no material, usemtl c has no faces, and the two usemtl a are one draw
+	const std::vector<objParser::MaterialRange> expected = { { 3, 6, 1 }, { 9, 6, 0 }, { 15, 3, 1 } };
+	EXPECT_EQ(meshs.at(0).materialRanges, expected);
+	EXPECT_EQ(meshs.at(0).mtlIndex, 2);
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 }));
+}
+
+TEST(MaterialRange, rangesStartOverForEachMesh) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials = MaterialRangeTestHelpers::makeMaterials();
+
+	std::string contents = MaterialRangeTestHelpers::makeObj("usemtl c\nf 1 2 3\no u\nv 0 0 0\nf -1 -1 -1\nusemtl b\nf -1 -1 -1\n");
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+
+	EXPECT_EQ(meshs.at(0).materialRanges, std::vector<objParser::MaterialRange>({ { 0, 3, 2 } }));
+	EXPECT_EQ(meshs.at(1).materialRanges, std::vector<objParser::MaterialRange>({ { 3, 3, 1 } }));
+}
+
+TEST(MaterialRange, sortsFacesByMaterial) {
+	std::string contents = MaterialRangeTestHelpers::makeObj(
+		"f 1/1 2/2 3/3\n"
+		"usemtl c\nf 4/4 5/5 6/6\n"
+		"usemtl a\nf 7/7 8/8 9/9\n"
+		"usemtl c\nf 10/10 11/11 12/12\n"
+		"usemtl b\nf 13/13 14/14 15/15\n"
+		"usemtl a\nf 16/16 17/17 18/18\n");
+
+	objParser::ParseOptions options;
+	options.sortFacesByMaterial = true;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials = MaterialRangeTestHelpers::makeMaterials();
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+
+	// one draw per material, the unmaterialed face stays first and every material keeps its faces in file order
+	const std::vector<objParser::MaterialRange> expected = { { 3, 6, 0 }, { 9, 3, 1 }, { 12, 6, 2 } };
+	EXPECT_EQ(meshs.at(0).materialRanges, expected);
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 1, 2, 6, 7, 8, 15, 16, 17, 12, 13, 14, 3, 4, 5, 9, 10, 11 }));
+	EXPECT_EQ(meshs.at(0).vertexTextureCoordinatesIndexes, meshs.at(0).vertexIndexes);
+
+	// the stream parse gives the same
+	std::istringstream stream(contents);
+	std::vector<objParser::Mesh> streamMeshs;
+	ASSERT_EQ(objParser::parseObjStream(stream, "", streamMeshs, materials, options), objParser::ErrorType::OK);
+	EXPECT_EQ(streamMeshs.at(0).materialRanges, expected);
+	EXPECT_EQ(streamMeshs.at(0).vertexIndexes, meshs.at(0).vertexIndexes);
+}
+
+TEST(MaterialRange, leavesMixedFacesUnsorted) {
+	// the vt indices only cover some faces, so moving faces around would pair them up wrong
+	std::string contents = MaterialRangeTestHelpers::makeObj("usemtl b\nf 1 2 3\nusemtl a\nf 4/4 5/5 6/6\n");
+
+	objParser::ParseOptions options;
+	options.sortFacesByMaterial = true;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials = MaterialRangeTestHelpers::makeMaterials();
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+
+	EXPECT_EQ(meshs.at(0).materialRanges, std::vector<objParser::MaterialRange>({ { 0, 3, 1 }, { 3, 3, 0 } }));
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 1, 2, 3, 4, 5 }));
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <ranges>
+#include <sstream>
+#include <string>
+
+static_assert(std::ranges::input_range<objParser::MeshGenerator>);
+
+namespace MeshGeneratorTestHelpers {
+	// a few meshs with materials, negative indices and polygons
+	inline std::string makeObj() {
+		std::string obj = "mtllib mtlTest3_1.mtl\n";
+		for (int mesh = 0; mesh < 5; mesh++) {
+			obj += "o mesh" + std::to_string(mesh) + "\n";
+			for (int i = 0; i < 6; i++) {
+				obj += "v " + std::to_string(i % 3) + " " + std::to_string(i / 3) + " " + std::to_string(mesh) + "\n";
+				obj += "vn 0 0 1\n";
+			}
+			obj += mesh % 2 == 0 ? "usemtl t1\n" : "usemtl t2\n";
+			obj += "f 1//1 2//2 5//5 4//4\n";
+			obj += "usemtl t1\n";
+			obj += "f -5//-5 -4//-4 -1//-1 -2//-2\n";
+		}
+		return obj;
+	}
+
+	inline void expectSameMesh(const objParser::Mesh& mesh, const objParser::Mesh& expected) {
+		EXPECT_EQ(mesh.name, expected.name);
+		EXPECT_EQ(mesh.vertices, expected.vertices) << mesh.name;
+		EXPECT_EQ(mesh.vertexTextureCoordinates, expected.vertexTextureCoordinates) << mesh.name;
+		EXPECT_EQ(mesh.vertexNormals, expected.vertexNormals) << mesh.name;
+		EXPECT_EQ(mesh.vertexIndexes, expected.vertexIndexes) << mesh.name;
+		EXPECT_EQ(mesh.vertexTextureCoordinatesIndexes, expected.vertexTextureCoordinatesIndexes) << mesh.name;
+		EXPECT_EQ(mesh.vertexNormalsIndexes, expected.vertexNormalsIndexes) << mesh.name;
+		EXPECT_EQ(mesh.materialRanges, expected.materialRanges) << mesh.name;
+		if (!expected.materialRanges.empty()) {
+			EXPECT_EQ(mesh.mtlIndex, expected.mtlIndex) << mesh.name;
+		}
+	}
+}
+
+TEST(MeshGenerator, givesTheSameMeshsAsParseObjStream) {
+	std::string obj = MeshGeneratorTestHelpers::makeObj();
+
+	for (objParser::FaceIndexing faceIndexing : { objParser::FaceIndexing::perObject, objParser::FaceIndexing::fileWide }) {
+		for (bool sort : { false, true }) {
+			objParser::ParseOptions options;
+			options.triangulation = objParser::Triangulation::earClipping;
+			options.faceIndexing = faceIndexing;
+			options.sortFacesByMaterial = sort;
+
+			std::vector<objParser::Mesh> expected;
+			std::vector<objParser::Material> expectedMaterials;
+			std::istringstream expectedStream(obj);
+			ASSERT_EQ(objParser::parseObjStream(expectedStream, "../tests/TestAssets", expected, expectedMaterials, options), objParser::ErrorType::OK);
+
+			std::vector<objParser::Material> materials;
+			std::istringstream stream(obj);
+			objParser::MeshGenerator meshs = objParser::parseObjMeshs(stream, "../tests/TestAssets", materials, options);
+
+			size_t count = 0;
+			for (objParser::Mesh& mesh : meshs) {
+				ASSERT_LT(count, expected.size());
+				MeshGeneratorTestHelpers::expectSameMesh(mesh, expected[count]);
+				count++;
+			}
+
+			EXPECT_EQ(meshs.error(), objParser::ErrorType::OK) << meshs.error().message;
+			EXPECT_EQ(count, expected.size());
+			EXPECT_EQ(materials.size(), expectedMaterials.size());
+		}
+	}
+}
+
+TEST(MeshGenerator, readsAFile) {
+	std::vector<objParser::Mesh> expected;
+	std::vector<objParser::Material> expectedMaterials;
+	ASSERT_EQ(objParser::parseObjFile("../tests/TestAssets/objTest3.obj", expected, expectedMaterials), objParser::ErrorType::OK);
+
+	std::vector<objParser::Material> materials;
+	std::vector<objParser::Mesh> meshs;
+	objParser::MeshGenerator generator = objParser::parseObjMeshs("../tests/TestAssets/objTest3.obj", materials);
+	for (objParser::Mesh& mesh : generator) {
+		meshs.push_back(std::move(mesh));
+	}
+
+	ASSERT_EQ(generator.error(), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), expected.size());
+	for (size_t i = 0; i < meshs.size(); i++) {
+		MeshGeneratorTestHelpers::expectSameMesh(meshs[i], expected[i]);
+	}
+	EXPECT_EQ(materials.size(), 2);
+}
+
+TEST(MeshGenerator, givesOutAMeshBeforeReadingThePartsAfterIt) {
+	// the second mesh is broken, but the first is already done by the time that is found
+	const std::string obj =
+		"o first\n"
+		"v 1 2 3\n"
+		"v 4 5 6\n"
+		"v 7 8 9\n"
+		"f 1 2 3\n"
+		"o second\n"
+		"v 1 2 3\n"
+		"f 1 2 3\n";
+
+	std::vector<objParser::Material> materials;
+	std::istringstream stream(obj);
+	objParser::MeshGenerator meshs = objParser::parseObjMeshs(stream, "", materials);
+
+	auto it = meshs.begin();
+	ASSERT_NE(it, meshs.end());
+	EXPECT_EQ(it->name, "first");
+	EXPECT_EQ(it->vertexIndexes, std::vector<objParser::Index>({ 0, 1, 2 }));
+	EXPECT_EQ(meshs.error(), objParser::ErrorType::OK);
+
+	++it;
+	EXPECT_EQ(it, meshs.end());
+	EXPECT_EQ(meshs.error(), objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(meshs.error().message, "Vertex '2' out of range. Expected less than '1'");
+}
+
+TEST(MeshGenerator, parsesNothingUntilIterated) {
+	std::vector<objParser::Material> materials;
+	objParser::MeshGenerator meshs = objParser::parseObjMeshs("../tests/TestAssets/doesntExist.obj", materials);
+
+	EXPECT_EQ(meshs.error(), objParser::ErrorType::OK);
+	EXPECT_EQ(meshs.begin(), meshs.end());
+	EXPECT_EQ(meshs.error(), objParser::ErrorType::FileNotFound);
+}
+
+TEST(MeshGenerator, stopsEarlyWithoutReadingTheRest) {
+	std::string obj = MeshGeneratorTestHelpers::makeObj();
+
+	std::vector<objParser::Material> materials;
+	std::istringstream stream(obj);
+	{
+		objParser::MeshGenerator meshs = objParser::parseObjMeshs(stream, "../tests/TestAssets", materials);
+		for (objParser::Mesh& mesh : meshs) {
+			EXPECT_EQ(mesh.name, "mesh0");
+			break;
+		}
+	}
+
+	// dropping the generator part way through just ends the parse, what it already loaded stays
+	EXPECT_EQ(materials.size(), 2);
+}
+
+TEST(MeshGenerator, emptyFileGivesNothing) {
+	std::vector<objParser::Material> materials;
+	std::istringstream stream("# nothing here\n");
+	objParser::MeshGenerator meshs = objParser::parseObjMeshs(stream, "", materials);
+
+	EXPECT_EQ(meshs.begin(), meshs.end());
+	EXPECT_EQ(meshs.error(), objParser::ErrorType::OK);
+}
+
+TEST(MeshGenerator, writesScratchStatistics) {
+	std::string obj = MeshGeneratorTestHelpers::makeObj();
+
+	objParser::ScratchStatistics statistics;
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::fan;
+	options.sortFacesByMaterial = true;
+	options.scratchStatistics = &statistics;
+
+	std::vector<objParser::Material> materials;
+	std::istringstream stream(obj);
+	objParser::MeshGenerator meshs = objParser::parseObjMeshs(stream, "../tests/TestAssets", materials, options);
+
+	// the stream buffer is there as soon as the first mesh is, and the sorts add to it after that
+	size_t allocations = 0;
+	for (objParser::Mesh& mesh : meshs) {
+		EXPECT_GT(statistics.allocations, 0) << mesh.name;
+		EXPECT_GE(statistics.allocations, allocations) << mesh.name;
+		allocations = statistics.allocations;
+	}
+
+	ASSERT_EQ(meshs.error(), objParser::ErrorType::OK);
+	EXPECT_EQ(statistics.allocations, allocations);
+	EXPECT_GE(statistics.heapAllocations, 1);
+}
\ No newline at end of file
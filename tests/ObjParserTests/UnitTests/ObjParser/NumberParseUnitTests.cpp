@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <random>
+#include <bit>
+#include <cstdio>
+#include <cmath>
+
+// the tokenizer has to round exactly like the operator>> it replaced, so compare the bits against it directly
+
+namespace NumberParseHelpers {
+	struct StreamResult {
+		bool ok;
+		float value;
+	};
+
+	inline StreamResult parseWithStream(const std::string& number) {
+		std::istringstream stream(number);
+		stream.imbue(std::locale::classic());
+
+		float value = 0.0f;
+		bool ok = static_cast<bool>(stream >> value);
+		return { ok, value };
+	}
+
+	inline void expectMatchesStream(const std::string& number) {
+		StreamResult expected = parseWithStream(number);
+
+		objParser::LineTokenizer tokens(number);
+		float value = 0.0f;
+		bool ok = tokens.next(value);
+
+		ASSERT_EQ(ok, expected.ok) << "'" << number << "'";
+		if (ok) {
+			EXPECT_EQ(std::bit_cast<uint32_t>(value), std::bit_cast<uint32_t>(expected.value)) << "'" << number << "'";
+		}
+	}
+
+	// numbers in the shapes exporters actually write, plus some that are not
+	inline std::vector<std::string> makeCorpus() {
+		std::vector<std::string> corpus;
+		std::mt19937_64 rng(0x0b1ec7);
+		std::uniform_real_distribution<double> unit(-1.0, 1.0);
+		std::uniform_int_distribution<int> decimals(0, 9);
+		std::uniform_int_distribution<int> magnitude(-12, 12);
+		std::uniform_int_distribution<int> bigExponent(-45, 38);
+		std::uniform_int_distribution<uint64_t> bits(0, UINT64_MAX);
+
+		char buffer[128];
+		for (int i = 0; i < 20000; i++) {
+			double value = unit(rng) * std::pow(10.0, magnitude(rng));
+
+			std::snprintf(buffer, sizeof(buffer), "%.*f", decimals(rng), value);
+			corpus.emplace_back(buffer);
+
+			std::snprintf(buffer, sizeof(buffer), "%.*e", decimals(rng), value);
+			corpus.emplace_back(buffer);
+
+			std::snprintf(buffer, sizeof(buffer), "%.9ge%d", unit(rng), bigExponent(rng));
+			corpus.emplace_back(buffer);
+
+			// more digits than a float can hold, so these all take the slow path
+			std::snprintf(buffer, sizeof(buffer), "%llu.%llu", static_cast<unsigned long long>(bits(rng)), static_cast<unsigned long long>(bits(rng)));
+			corpus.emplace_back(buffer);
+
+			// every float printed back out with enough digits to round trip
+			float randomFloat = std::bit_cast<float>(static_cast<uint32_t>(bits(rng)));
+			if (std::isfinite(randomFloat)) {
+				std::snprintf(buffer, sizeof(buffer), "%.9g", randomFloat);
+				corpus.emplace_back(buffer);
+			}
+		}
+
+		return corpus;
+	}
+}
+
+TEST(NumberParse, matchesStreamOnEdgeCases) {
+	const std::vector<std::string> edgeCases = {
+		"0", "-0", "+0", "0.0", "-0.0", "1", "-1", "+1", "1.", ".5", "-.5", "+.5",
+		"0.1", "0.2", "0.3", "1e1", "1E1", "1e+1", "1e-1", "1.5e3", "16777216", "16777217", "16777218", "16777216.5",
+		"0.000001", "0.0000001", "123456789", "1234567890123", "123456789012345678901234567890",
+		"3.4028234e38", "3.4028235e38", "3.4028236e38", "1e38", "1e39", "-1e39",
+		"1.1754944e-38", "1e-38", "1e-40", "1.4e-45", "1e-45", "7e-46", "1e-50", "-1e-50",
+		"0.00000000000000000000000000000000000000000000000001",
+		"0001.0000", "1.5abc", "2/3", "4.0#",
+		"1e", "1e+", "2E-", "4.E+", "1e#", "1ex"
+	};
+
+	for (const std::string& number : edgeCases) {
+		NumberParseHelpers::expectMatchesStream(number);
+	}
+}
+
+TEST(NumberParse, matchesStreamOnCorpus) {
+	for (const std::string& number : NumberParseHelpers::makeCorpus()) {
+		NumberParseHelpers::expectMatchesStream(number);
+	}
+}
+
+TEST(NumberParse, alwaysUsesDecimalPoint) {
+	// the decimal point is always '.', a ',' ends the number no matter what locale the program has set
+	objParser::LineTokenizer tokens("1.5 2,5");
+
+	float x = 0.0f, y = 0.0f;
+	ASSERT_TRUE(tokens.next(x));
+	ASSERT_TRUE(tokens.next(y));
+
+	EXPECT_EQ(x, 1.5f);
+	EXPECT_EQ(y, 2.0f);
+}
+
+TEST(NumberParse, matchesStreamOnInts) {
+	const std::vector<std::string> edgeCases = { "0", "1", "-1", "+1", "007", "-007", "2147483647", "-2147483648", "2147483648", "-2147483649", "+-1", "-+1", "1/2" };
+
+	for (const std::string& number : edgeCases) {
+		std::istringstream stream(number);
+		int expected = 0;
+		bool expectedOk = static_cast<bool>(stream >> expected);
+
+		objParser::LineTokenizer tokens(number);
+		int value = 0;
+		bool ok = tokens.next(value);
+
+		ASSERT_EQ(ok, expectedOk) << "'" << number << "'";
+		if (ok) {
+			EXPECT_EQ(value, expected) << "'" << number << "'";
+		}
+	}
+}
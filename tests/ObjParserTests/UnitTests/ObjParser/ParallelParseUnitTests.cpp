@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <cstring>
+
+// the parallel parse has to give back exactly what the serial parse does, bit for bit, errors included
+
+namespace ParallelParseTestHelpers {
+	// random but valid obj text, with the awkward bits (negative indices, usemtl, mtllib, objects) everywhere so chunk edges land on them
+	inline std::string makeRandomObj(uint32_t seed, bool continuesMesh, bool injectError) {
+		std::mt19937 rng(seed);
+		auto chance = [&rng](int percent) {
+			return std::uniform_int_distribution<int>(0, 99)(rng) < percent;
+		};
+		auto pick = [&rng](int low, int high) {
+			return std::uniform_int_distribution<int>(low, high)(rng);
+		};
+		auto number = [&rng, &pick]() {
+			std::ostringstream oss;
+			switch (pick(0, 3)) {
+			case 0:
+				oss << pick(-100, 100);
+				break;
+			case 1:
+				oss << std::uniform_real_distribution<float>(-10.0f, 10.0f)(rng);
+				break;
+			case 2:
+				oss << std::fixed << std::uniform_real_distribution<float>(-1.0f, 1.0f)(rng) << "e" << pick(-40, 30);
+				break;
+			default:
+				oss << "0." << pick(0, 999999);
+				break;
+			}
+			return oss.str();
+		};
+
+		std::string contents;
+		bool hasObject = continuesMesh;
+		bool hasLibrary = false;
+
+		// the existing mesh starts with these
+		int vertices = continuesMesh ? 3 : 0;
+		int vertexTextures = 0;
+		int vertexNormals = 0;
+
+		// a serial parse only gets as far as the error, so there is no point writing much after it
+		int lineCount = pick(50, 600);
+		int errorLine = injectError ? pick(0, lineCount - 1) : -1;
+
+		auto index = [&pick, &chance](int count) {
+			int i = pick(1, count);
+			return chance(40) ? std::to_string(i - count - 1) : std::to_string(i);
+		};
+
+		for (int line = 0; line < lineCount; line++) {
+			if (line == errorLine) {
+				switch (pick(0, 4)) {
+				case 0:
+					contents += "f 1 2\n";
+					break;
+				case 1:
+					contents += "f 999999 1 1\n";
+					break;
+				case 2:
+					contents += "usemtl missing\n";
+					break;
+				case 3:
+					contents += "bogus line\n";
+					break;
+				default:
+					contents += "v 1 2\n";
+					break;
+				}
+				continue;
+			}
+
+			if (!hasObject || chance(3)) {
+				contents += "o mesh" + std::to_string(line) + "\n";
+				// every mesh gets a material, so mtlIndex is always set and can be compared
+				contents += "usemtl m" + std::to_string(pick(0, 1)) + "\n";
+				hasObject = true;
+				vertices = vertexTextures = vertexNormals = 0;
+				continue;
+			}
+
+			int kind = pick(0, 99);
+			if (kind < 30) {
+				contents += (chance(10) ? "  v\t" : "v ") + number() + " " + number() + " " + number();
+				if (chance(10)) {
+					contents += " " + std::to_string(pick(1, 4));
+				}
+				contents += chance(5) ? "\r\n" : "\n";
+				vertices++;
+			} else if (kind < 40) {
+				contents += "vt " + number() + " " + number() + "\n";
+				vertexTextures++;
+			} else if (kind < 50) {
+				contents += "vn " + number() + " " + number() + " " + number() + "\n";
+				vertexNormals++;
+			} else if (kind < 85) {
+				if (vertices == 0) {
+					continue;
+				}
+
+				bool withTexture = vertexTextures > 0 && chance(50);
+				bool withNormal = vertexNormals > 0 && chance(50);
+
+				contents += "f";
+				for (int i = 0; i < 3; i++) {
+					contents += " " + index(vertices);
+					if (withTexture) {
+						contents += "/" + index(vertexTextures);
+					} else if (withNormal) {
+						contents += "/";
+					}
+					if (withNormal) {
+						contents += "/" + index(vertexNormals);
+					}
+				}
+				contents += "\n";
+			} else if (kind < 90) {
+				contents += "usemtl " + std::string(hasLibrary && chance(50) ? (chance(50) ? "t1" : "t2") : (chance(50) ? "m0" : "m1")) + "\n";
+			} else if (kind < 92) {
+				contents += "mtllib mtlTest3_1.mtl\n";
+				hasLibrary = true;
+			} else if (kind < 96) {
+				contents += "# a comment\n";
+			} else {
+				contents += "\n";
+			}
+		}
+
+		// sometimes no newline at the end
+		if (chance(50) && !contents.empty()) {
+			contents.pop_back();
+		}
+
+		return contents;
+	}
+
+	template <typename T>
+	inline bool sameBits(const std::vector<T>& a, const std::vector<T>& b) {
+		return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+	}
+
+	struct ParseState {
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+		objParser::Error error;
+	};
+
+	inline ParseState makeStartState(bool continuesMesh) {
+		ParseState state;
+		state.materials.emplace_back("m0");
+		state.materials.emplace_back("m1");
+
+		if (continuesMesh) {
+			state.meshs.emplace_back("existing");
+			state.meshs.back().vertices = { { 1,2,3 }, { 4,5,6 }, { 7,8,9 } };
+			state.meshs.back().mtlIndex = 0;
+		}
+
+		return state;
+	}
+
+	inline void expectSameState(const ParseState& expected, const ParseState& actual, uint32_t seed) {
+		ASSERT_EQ(actual.error.errorType, expected.error.errorType) << "seed " << seed;
+		ASSERT_EQ(actual.error.message, expected.error.message) << "seed " << seed;
+
+		ASSERT_EQ(actual.materials.size(), expected.materials.size()) << "seed " << seed;
+		for (size_t i = 0; i < expected.materials.size(); i++) {
+			EXPECT_EQ(actual.materials[i].name, expected.materials[i].name) << "seed " << seed;
+			EXPECT_EQ(actual.materials[i].ambientColor, expected.materials[i].ambientColor) << "seed " << seed;
+		}
+
+		ASSERT_EQ(actual.meshs.size(), expected.meshs.size()) << "seed " << seed;
+		for (size_t i = 0; i < expected.meshs.size(); i++) {
+			const objParser::Mesh& expectedMesh = expected.meshs[i];
+			const objParser::Mesh& mesh = actual.meshs[i];
+
+			EXPECT_EQ(mesh.name, expectedMesh.name) << "seed " << seed;
+			EXPECT_TRUE(sameBits(mesh.vertices, expectedMesh.vertices)) << "seed " << seed << " mesh " << i;
+			EXPECT_TRUE(sameBits(mesh.vertexTextureCoordinates, expectedMesh.vertexTextureCoordinates)) << "seed " << seed << " mesh " << i;
+			EXPECT_TRUE(sameBits(mesh.vertexNormals, expectedMesh.vertexNormals)) << "seed " << seed << " mesh " << i;
+			EXPECT_EQ(mesh.vertexIndexes, expectedMesh.vertexIndexes) << "seed " << seed << " mesh " << i;
+			EXPECT_EQ(mesh.vertexTextureCoordinatesIndexes, expectedMesh.vertexTextureCoordinatesIndexes) << "seed " << seed << " mesh " << i;
+			EXPECT_EQ(mesh.vertexNormalsIndexes, expectedMesh.vertexNormalsIndexes) << "seed " << seed << " mesh " << i;
+			EXPECT_EQ(mesh.materialRanges, expectedMesh.materialRanges) << "seed " << seed << " mesh " << i;
+
+			// an error can land between an o and its usemtl, which leaves the last mtlIndex unset
+			if (expected.error == objParser::ErrorType::OK || i + 1 < expected.meshs.size()) {
+				EXPECT_EQ(mesh.mtlIndex, expectedMesh.mtlIndex) << "seed " << seed << " mesh " << i;
+			}
+		}
+	}
+}
+
+TEST(ObjParserParallelParse, matchesSerialOnRandomFiles) {
+	for (uint32_t seed = 0; seed < 300; seed++) {
+		bool continuesMesh = seed % 2 == 1;
+		bool injectError = seed % 5 == 4;
+
+		std::string contents = ParallelParseTestHelpers::makeRandomObj(seed, continuesMesh, injectError);
+
+		objParser::ParseOptions serialOptions;
+		serialOptions.sortFacesByMaterial = seed % 3 == 0;
+		// the random indices only ever reach back within their object, so they are just as valid counted file wide
+		// as long as there isnt a mesh to carry on, its vertices arent in the file's pool
+		serialOptions.faceIndexing = seed % 4 == 2 ? objParser::FaceIndexing::fileWide : objParser::FaceIndexing::perObject;
+
+		ParallelParseTestHelpers::ParseState serial = ParallelParseTestHelpers::makeStartState(continuesMesh);
+		serial.error = objParser::parseObjBuffer(contents, "../tests/TestAssets", serial.meshs, serial.materials, serialOptions);
+		if (!injectError) {
+			ASSERT_EQ(serial.error, objParser::ErrorType::OK) << "seed " << seed << " " << serial.error.message;
+		}
+
+		objParser::ParseOptions options = serialOptions;
+		options.threadCount = 2 + seed % 7;
+		// tiny chunks so the edges land on every kind of line
+		options.minimumChunkSize = 16;
+
+		ParallelParseTestHelpers::ParseState parallel = ParallelParseTestHelpers::makeStartState(continuesMesh);
+		parallel.error = objParser::parseObjBuffer(contents, "../tests/TestAssets", parallel.meshs, parallel.materials, options);
+
+		ParallelParseTestHelpers::expectSameState(serial, parallel, seed);
+	}
+}
+
+TEST(ObjParserParallelParse, startsWithoutAnObject) {
+	// every chunk errors or not exactly like the serial parse does
+	std::string contents = "v 1 2 3\nv 1 2 3\no t\nv 1 2 3\n";
+
+	objParser::ParseOptions options;
+	options.threadCount = 4;
+	options.minimumChunkSize = 1;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	objParser::Error error = objParser::parseObjBuffer(contents, "", meshs, materials, options);
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(error.message, "Trying to read data before any objects have been defined");
+	EXPECT_TRUE(meshs.empty());
+}
+
+TEST(ObjParserParallelParse, parsesFileWithThreads) {
+	objParser::ParseOptions options;
+	options.threadCount = 0;
+	options.minimumChunkSize = 1;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjFile("../tests/TestAssets/objTest3.obj", meshs, materials, options), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 1);
+	ASSERT_EQ(materials.size(), 2);
+
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0,1,2 }));
+	EXPECT_EQ(meshs.at(0).mtlIndex, 1);
+}
+
+TEST(ObjParserParallelParse, fallingBackListsOnlyTheLibrariesTheSerialParseLoaded) {
+	// the second library cant be loaded, so this starts again serially, which stops at the bad line before it gets there
+	std::string contents = "mtllib mtlTest3_1.mtl\no t\n";
+	for (int i = 0; i < 20; i++) {
+		contents += "v 1 2 3\n";
+	}
+	contents += "v 1 x 3\n";
+	for (int i = 0; i < 20; i++) {
+		contents += "v 1 2 3\n";
+	}
+	contents += "mtllib doesntExist.mtl\n";
+
+	std::vector<std::filesystem::path> libraries = { "alreadyThere.mtl" };
+
+	objParser::ParseOptions options;
+	options.threadCount = 4;
+	options.minimumChunkSize = 1;
+	options.materialLibraries = &libraries;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	EXPECT_EQ(objParser::parseObjBuffer(contents, "../tests/TestAssets", meshs, materials, options), objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(materials.size(), 2);
+	EXPECT_EQ(libraries, std::vector<std::filesystem::path>({ "alreadyThere.mtl", std::filesystem::path("../tests/TestAssets") / "mtlTest3_1.mtl" }));
+}
\ No newline at end of file
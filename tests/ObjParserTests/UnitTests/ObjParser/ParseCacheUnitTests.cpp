@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace ParseCacheTestHelpers {
+	// a directory with an obj and its mtl in it, and an empty cache directory next to them, all gone once it goes out of scope
+	struct CacheFixture {
+		std::filesystem::path root;
+		std::filesystem::path objPath;
+		std::filesystem::path mtlPath;
+		std::filesystem::path cacheDirectory;
+
+		explicit CacheFixture(std::string_view name) :
+			root(std::filesystem::temp_directory_path() / ("objParserParseCache_" + std::string(name))),
+			objPath(root / "model.obj"),
+			mtlPath(root / "model.mtl"),
+			cacheDirectory(root / "cache") {
+			std::filesystem::remove_all(root);
+			std::filesystem::create_directories(root);
+
+			write(objPath, "mtllib model.mtl\no t\nv 0 0 0\nv 1 0 0\nv 1 1 0\nusemtl red\nf 1 2 3\n");
+			write(mtlPath, "newmtl red\nKd 1 0 0\n");
+		}
+
+		~CacheFixture() {
+			std::filesystem::remove_all(root);
+		}
+
+		static void write(const std::filesystem::path& path, std::string_view contents) {
+			std::ofstream out(path, std::ios::binary | std::ios::trunc);
+			out << contents;
+		}
+
+		objParser::ParseOptions options() const {
+			objParser::ParseOptions options;
+			options.cacheDirectory = cacheDirectory;
+			return options;
+		}
+
+		size_t entryCount() const {
+			size_t count = 0;
+			for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+				count += entry.path().extension() == ".objcache";
+			}
+			return count;
+		}
+	};
+
+	// a miss renames a new entry into place, so an entry that is still the file it was linked to before the parse means it was loaded
+	inline bool parseFromCache(const CacheFixture& fixture, std::vector<objParser::Mesh>& meshs, std::vector<objParser::Material>& materials, const objParser::ParseOptions& options) {
+		std::filesystem::path links = fixture.root / "links";
+		std::filesystem::remove_all(links);
+		std::filesystem::create_directories(links);
+		std::filesystem::create_directories(fixture.cacheDirectory);
+
+		size_t entriesBefore = fixture.entryCount();
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(fixture.cacheDirectory)) {
+			std::filesystem::create_hard_link(entry.path(), links / entry.path().filename());
+		}
+
+		EXPECT_EQ(objParser::parseObjFile(fixture.objPath, meshs, materials, options), objParser::ErrorType::OK);
+
+		bool untouched = fixture.entryCount() == entriesBefore;
+		for (const std::filesystem::directory_entry& link : std::filesystem::directory_iterator(links)) {
+			std::filesystem::path entry = fixture.cacheDirectory / link.path().filename();
+			untouched = untouched && std::filesystem::exists(entry) && std::filesystem::equivalent(entry, link.path());
+		}
+		return untouched && entriesBefore != 0;
+	}
+}
+
+TEST(ParseCache, contentHashIgnoresHowItIsSplit) {
+	std::string contents;
+	for (int i = 0; i < 200; i++) {
+		contents += static_cast<char>(i * 7 + 3);
+	}
+
+	objParser::ContentHash whole;
+	whole.update(contents.data(), contents.size());
+
+	for (size_t step : { 1, 5, 31, 32, 33, 100 }) {
+		objParser::ContentHash pieces;
+		for (size_t i = 0; i < contents.size(); i += step) {
+			pieces.update(contents.data() + i, std::min(step, contents.size() - i));
+		}
+		EXPECT_EQ(pieces.finish(), whole.finish());
+	}
+
+	contents[150] ^= 1;
+	objParser::ContentHash changed;
+	changed.update(contents.data(), contents.size());
+	EXPECT_NE(changed.finish(), whole.finish());
+}
+
+TEST(ParseCache, loadsWhatItParsedBefore) {
+	ParseCacheTestHelpers::CacheFixture fixture("loads");
+
+	std::vector<objParser::Mesh> parsed;
+	std::vector<objParser::Material> parsedMaterials;
+	std::vector<std::filesystem::path> parsedLibraries;
+	objParser::ParseOptions parseOptions = fixture.options();
+	parseOptions.materialLibraries = &parsedLibraries;
+	EXPECT_FALSE(ParseCacheTestHelpers::parseFromCache(fixture, parsed, parsedMaterials, parseOptions));
+	EXPECT_EQ(fixture.entryCount(), 1);
+
+	std::vector<objParser::Mesh> cached;
+	std::vector<objParser::Material> cachedMaterials;
+	std::vector<std::filesystem::path> libraries;
+	objParser::ParseOptions options = fixture.options();
+	options.materialLibraries = &libraries;
+	EXPECT_TRUE(ParseCacheTestHelpers::parseFromCache(fixture, cached, cachedMaterials, options));
+
+	ASSERT_EQ(cached.size(), 1);
+	EXPECT_EQ(cached.at(0).vertices, parsed.at(0).vertices);
+	EXPECT_EQ(cached.at(0).vertexIndexes, parsed.at(0).vertexIndexes);
+	EXPECT_EQ(cached.at(0).mtlIndex, parsed.at(0).mtlIndex);
+	ASSERT_EQ(cachedMaterials.size(), 1);
+	EXPECT_EQ(cachedMaterials.at(0).diffuseColor, glm::vec3(1, 0, 0));
+	ASSERT_EQ(libraries.size(), 1);
+	EXPECT_TRUE(std::filesystem::equivalent(libraries.at(0), fixture.mtlPath));
+
+	// the libraries are listed the same whether the cache was warm or not, and only once each
+	EXPECT_EQ(libraries, parsedLibraries);
+	cached.clear();
+	cachedMaterials.clear();
+	EXPECT_TRUE(ParseCacheTestHelpers::parseFromCache(fixture, cached, cachedMaterials, options));
+	EXPECT_EQ(libraries, parsedLibraries);
+
+	// options that change the result get an entry of their own
+	options.layout = objParser::AttributeLayout::structOfArrays;
+	std::vector<objParser::Mesh> soa;
+	std::vector<objParser::Material> soaMaterials;
+	EXPECT_FALSE(ParseCacheTestHelpers::parseFromCache(fixture, soa, soaMaterials, options));
+	EXPECT_EQ(soa.at(0).vertexArrays.size(), 3);
+	EXPECT_EQ(fixture.entryCount(), 2);
+}
+
+TEST(ParseCache, parsesAgainWhenAFileChanges) {
+	ParseCacheTestHelpers::CacheFixture fixture("changes");
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, fixture.options());
+
+	// a different mtl file isnt a different key, but the entry knows it was made from the old one
+	ParseCacheTestHelpers::CacheFixture::write(fixture.mtlPath, "newmtl red\nKd 0 1 0\n");
+	meshs.clear();
+	materials.clear();
+	EXPECT_FALSE(ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, fixture.options()));
+	ASSERT_EQ(materials.size(), 1);
+	EXPECT_EQ(materials.at(0).diffuseColor, glm::vec3(0, 1, 0));
+	EXPECT_EQ(fixture.entryCount(), 1);
+
+	ParseCacheTestHelpers::CacheFixture::write(fixture.objPath, "mtllib model.mtl\no t\nv 0 0 0\nv 2 0 0\nv 1 1 0\nusemtl red\nf 1 2 3\n");
+	meshs.clear();
+	materials.clear();
+	EXPECT_FALSE(ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, fixture.options()));
+	EXPECT_EQ(meshs.at(0).vertices.at(1), glm::vec3(2, 0, 0));
+	EXPECT_EQ(fixture.entryCount(), 2);
+
+	// and a parse into vectors that already have something in them is just parsed, the cache is left alone
+	EXPECT_TRUE(ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, fixture.options()));
+	EXPECT_EQ(meshs.size(), 2);
+	EXPECT_EQ(materials.size(), 2);
+	EXPECT_EQ(meshs.at(1).mtlIndex, 0);
+}
+
+TEST(ParseCache, dropsTheLeastRecentlyUsed) {
+	ParseCacheTestHelpers::CacheFixture fixture("trims");
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	objParser::ParseOptions options = fixture.options();
+	ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, options);
+
+	uint64_t entrySize = 0;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(fixture.cacheDirectory)) {
+		entrySize = entry.file_size();
+	}
+
+	// room for one entry, so the second one pushes the first out
+	options.cacheSizeLimit = entrySize + entrySize / 2;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+	meshs.clear();
+	materials.clear();
+	ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, options);
+	EXPECT_EQ(fixture.entryCount(), 1);
+
+	meshs.clear();
+	materials.clear();
+	EXPECT_TRUE(ParseCacheTestHelpers::parseFromCache(fixture, meshs, materials, options));
+
+	std::ofstream(fixture.cacheDirectory / "0123456789abcdef.objcache.tmp0123");
+	std::filesystem::last_write_time(fixture.cacheDirectory / "0123456789abcdef.objcache.tmp0123", std::filesystem::file_time_type::clock::now() - std::chrono::hours(2));
+	objParser::trimParseCache(fixture.cacheDirectory, 0);
+	EXPECT_TRUE(std::filesystem::is_empty(fixture.cacheDirectory));
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+namespace QuantizeTestHelpers {
+	// lengths that arent a whole number of any kernel's block, so the scalar tails get used too
+	inline objParser::Mesh makeRandomMesh(size_t count, uint32_t seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> position(-50.0f, 120.0f);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> textureCoordinate(-2.0f, 3.0f);
+
+		objParser::Mesh mesh("random");
+		for (size_t i = 0; i < count; i++) {
+			mesh.vertices.emplace_back(position(rng), position(rng) * 0.01f, position(rng));
+			mesh.vertexTextureCoordinates.emplace_back(textureCoordinate(rng), textureCoordinate(rng), 0.0f);
+			mesh.vertexNormals.emplace_back(unit(rng), unit(rng), unit(rng));
+		}
+
+		// the awkward normals, straight down the axes and zero length
+		mesh.vertexNormals.at(0) = glm::vec3(0.0f, 0.0f, -1.0f);
+		mesh.vertexNormals.at(1) = glm::vec3(0.0f);
+		mesh.vertexNormals.at(2) = glm::vec3(-1.0f, 0.0f, 0.0f);
+
+		mesh.vertexIndexes = { 0, 1, 2 };
+		return mesh;
+	}
+
+	inline void expectSameQuantizedMesh(const objParser::QuantizedMesh& a, const objParser::QuantizedMesh& b) {
+		EXPECT_EQ(a.boundsMin, b.boundsMin);
+		EXPECT_EQ(a.boundsMax, b.boundsMax);
+		EXPECT_EQ(a.positions, b.positions);
+		EXPECT_EQ(a.textureCoordinateMin, b.textureCoordinateMin);
+		EXPECT_EQ(a.textureCoordinateMax, b.textureCoordinateMax);
+		EXPECT_EQ(a.textureCoordinates, b.textureCoordinates);
+		EXPECT_EQ(a.normals, b.normals);
+		EXPECT_EQ(a.maxPositionError, b.maxPositionError);
+		EXPECT_EQ(a.maxTextureCoordinateError, b.maxTextureCoordinateError);
+		EXPECT_EQ(a.maxNormalError, b.maxNormalError);
+	}
+}
+
+TEST(Quantize, halvesRoundTrip) {
+	// every finite half has to come back out exactly
+	for (uint32_t half = 0; half <= 0xffff; half++) {
+		if ((half & 0x7c00) == 0x7c00) {
+			continue;
+		}
+		ASSERT_EQ(objParser::floatToHalf(objParser::halfToFloat(static_cast<uint16_t>(half))), half) << half;
+	}
+
+	EXPECT_EQ(objParser::floatToHalf(1.0f), 0x3c00);
+	EXPECT_EQ(objParser::floatToHalf(-2.0f), 0xc000);
+	EXPECT_EQ(objParser::floatToHalf(65504.0f), 0x7bff);
+	EXPECT_EQ(objParser::floatToHalf(65520.0f), 0x7c00);
+	EXPECT_EQ(objParser::floatToHalf(std::ldexp(1.0f, -24)), 0x0001);
+	EXPECT_EQ(objParser::floatToHalf(std::ldexp(1.0f, -26)), 0x0000);
+
+	// ties go to even
+	EXPECT_EQ(objParser::floatToHalf(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+	EXPECT_EQ(objParser::floatToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3c02);
+}
+
+TEST(Quantize, everyLevelMatchesScalar) {
+	const std::vector<objParser::SimdLevel> levels = { objParser::SimdLevel::sse2, objParser::SimdLevel::avx2, objParser::SimdLevel::avx512 };
+
+	for (size_t count : { 3, 7, 25, 1001 }) {
+		objParser::Mesh mesh = QuantizeTestHelpers::makeRandomMesh(count, static_cast<uint32_t>(count));
+
+		for (objParser::TextureCoordinateEncoding encoding : { objParser::TextureCoordinateEncoding::half, objParser::TextureCoordinateEncoding::unorm16 }) {
+			objParser::QuantizeOptions options;
+			options.textureCoordinateEncoding = encoding;
+
+			objParser::QuantizedMesh expected;
+			{
+				ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(objParser::SimdLevel::scalar);
+				ASSERT_EQ(objParser::quantizeMesh(mesh, expected, options), objParser::ErrorType::OK);
+			}
+
+			for (objParser::SimdLevel level : levels) {
+				ByteScannerTestHelpers::ScopedSimdLevel scopedLevel(level);
+				if (objParser::activeSimdLevel() != level) {
+					continue;
+				}
+
+				objParser::QuantizedMesh quantizedMesh;
+				ASSERT_EQ(objParser::quantizeMesh(mesh, quantizedMesh, options), objParser::ErrorType::OK);
+
+				SCOPED_TRACE(::testing::Message() << level << " count " << count);
+				QuantizeTestHelpers::expectSameQuantizedMesh(quantizedMesh, expected);
+			}
+		}
+	}
+}
+
+TEST(Quantize, staysWithinTheStepSize) {
+	objParser::Mesh mesh = QuantizeTestHelpers::makeRandomMesh(5000, 3);
+
+	objParser::QuantizedMesh quantizedMesh;
+	ASSERT_EQ(objParser::quantizeMesh(mesh, quantizedMesh), objParser::ErrorType::OK);
+
+	ASSERT_EQ(quantizedMesh.vertexCount(), 5000);
+	ASSERT_EQ(quantizedMesh.vertexTextureCoordinateCount(), 5000);
+	ASSERT_EQ(quantizedMesh.vertexNormalCount(), 5000);
+	EXPECT_EQ(quantizedMesh.vertexIndexes, mesh.vertexIndexes);
+
+	// half a step of the widest axis, with a little room for float rounding
+	glm::vec3 extent = quantizedMesh.boundsMax - quantizedMesh.boundsMin;
+	float positionStep = std::max({ extent.x, extent.y, extent.z }) / 65535.0f;
+	EXPECT_GT(quantizedMesh.maxPositionError, 0.0f);
+	EXPECT_LE(quantizedMesh.maxPositionError, positionStep * 0.5f + 1.0e-5f);
+
+	// halves have 11 bits of precision, the largest uv is below 4
+	EXPECT_LE(quantizedMesh.maxTextureCoordinateError, std::ldexp(1.0f, -10));
+
+	// 16 bit octahedral normals are good to a few hundredths of a degree
+	EXPECT_GT(quantizedMesh.maxNormalError, 0.0f);
+	EXPECT_LE(quantizedMesh.maxNormalError, 2.0e-4f);
+
+	// the reported error has to be the real one
+	for (size_t i = 0; i < quantizedMesh.vertexCount(); i++) {
+		ASSERT_TRUE(TestHelpers::check_vec3_close_vec3(quantizedMesh.position(i), mesh.vertices[i], quantizedMesh.maxPositionError));
+	}
+
+	EXPECT_EQ(quantizedMesh.normal(1), glm::vec3(0.0f, 0.0f, 1.0f));
+	EXPECT_TRUE(TestHelpers::check_vec3_close_vec3(quantizedMesh.normal(0), glm::vec3(0.0f, 0.0f, -1.0f)));
+	EXPECT_TRUE(TestHelpers::check_vec3_close_vec3(quantizedMesh.normal(2), glm::vec3(-1.0f, 0.0f, 0.0f)));
+}
+
+TEST(Quantize, unormTextureCoordinatesUseTheirRange) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nvt 0.25 -1\nvt 0.75 1\nvt 0.5 0", "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::QuantizeOptions options;
+	options.textureCoordinateEncoding = objParser::TextureCoordinateEncoding::unorm16;
+
+	objParser::QuantizedMesh quantizedMesh;
+	ASSERT_EQ(objParser::quantizeMesh(meshs.at(0), quantizedMesh, options), objParser::ErrorType::OK);
+
+	EXPECT_EQ(quantizedMesh.textureCoordinateMin, glm::vec2(0.25f, -1.0f));
+	EXPECT_EQ(quantizedMesh.textureCoordinateMax, glm::vec2(0.75f, 1.0f));
+	EXPECT_EQ(quantizedMesh.textureCoordinates, std::vector<uint16_t>({ 0, 0, 65535, 65535, 32768, 32768 }));
+
+	// the ends are exact
+	EXPECT_EQ(quantizedMesh.textureCoordinate(0), glm::vec2(0.25f, -1.0f));
+	EXPECT_EQ(quantizedMesh.textureCoordinate(1), glm::vec2(0.75f, 1.0f));
+
+	// a single vertex has no extent, it decodes back exactly
+	EXPECT_EQ(quantizedMesh.position(0), glm::vec3(0.0f));
+	EXPECT_EQ(quantizedMesh.maxPositionError, 0.0f);
+}
+
+TEST(Quantize, sameForBothLayouts) {
+	std::string contents = "o t\nv 1 -2 3\nv 4 5 -6\nv 0.1 0.2 0.3\nvt 0.5 0.5\nvt 0 1\nvn 0 1 0\nvn 0.3 -0.3 -0.9\nf 1/1/1 2/2/2 3/1/1";
+
+	std::vector<objParser::Mesh> aosMeshs;
+	std::vector<objParser::Mesh> soaMeshs;
+	std::vector<objParser::Material> materials;
+
+	objParser::ParseOptions options;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", aosMeshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", soaMeshs, materials, options), objParser::ErrorType::OK);
+
+	objParser::QuantizedMesh aos;
+	objParser::QuantizedMesh soa;
+	ASSERT_EQ(objParser::quantizeMesh(aosMeshs.at(0), aos), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::quantizeMesh(soaMeshs.at(0), soa), objParser::ErrorType::OK);
+
+	QuantizeTestHelpers::expectSameQuantizedMesh(soa, aos);
+	EXPECT_EQ(soa.vertexNormalsIndexes, std::vector<int>({ 0, 1, 0 }));
+}
+
+TEST(Quantize, rejectsValuesThatArentFinite) {
+	objParser::Mesh mesh("broken");
+	mesh.vertices = { { 0, 0, 0 }, { 1, std::numeric_limits<float>::infinity(), 0 } };
+
+	objParser::QuantizedMesh quantizedMesh;
+	objParser::Error error = objParser::quantizeMesh(mesh, quantizedMesh);
+
+	EXPECT_EQ(error, objParser::ErrorType::FileFormatError);
+	EXPECT_EQ(error.message, "Vertex '2' in mesh 'broken' isnt finite, so it cant be quantized");
+
+	mesh.vertices.pop_back();
+	mesh.vertexNormals = { { std::numeric_limits<float>::quiet_NaN(), 0, 1 } };
+	EXPECT_EQ(objParser::quantizeMesh(mesh, quantizedMesh), objParser::ErrorType::FileFormatError);
+}
\ No newline at end of file
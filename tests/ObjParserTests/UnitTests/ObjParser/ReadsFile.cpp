@@ -27,4 +27,48 @@ TEST(ObjParserReadsFile, readsBasicFile) {
 	EXPECT_EQ(meshs.at(0).vertices, std::vector<glm::vec3>({ { 1,2,3 }, { 4,5,6 }, { 7,8,9 } }));
 	EXPECT_EQ(meshs.at(0).vertexTextureCoordinates, std::vector<glm::vec3>({ { 1,0,.5 }, { .5,0,1 }, { 1,0,.5 } }));
 	EXPECT_EQ(meshs.at(0).vertexNormals, std::vector<glm::vec3>({ { 0,1,0 }, { 1,0,0 }, { 0,0,1 } }));
-}
\ No newline at end of file
+}
+
+TEST(ObjParserReadsFile, mappedAndStreamedMatch) {
+	std::vector<objParser::Mesh> mappedMeshs;
+	std::vector<objParser::Material> mappedMaterials;
+	std::vector<objParser::Mesh> streamedMeshs;
+	std::vector<objParser::Material> streamedMaterials;
+
+	objParser::ParseOptions mapped;
+	mapped.memoryMap = true;
+	mapped.prefault = true;
+	mapped.hugePages = true;
+
+	objParser::ParseOptions streamed;
+	streamed.memoryMap = false;
+
+	ASSERT_EQ(objParser::parseObjFile("../tests/TestAssets/objTest3.obj", mappedMeshs, mappedMaterials, mapped), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::parseObjFile("../tests/TestAssets/objTest3.obj", streamedMeshs, streamedMaterials, streamed), objParser::ErrorType::OK);
+
+	ASSERT_EQ(mappedMeshs.size(), streamedMeshs.size());
+	ASSERT_EQ(mappedMaterials.size(), streamedMaterials.size());
+
+	EXPECT_EQ(mappedMeshs.at(0).vertices, streamedMeshs.at(0).vertices);
+	EXPECT_EQ(mappedMeshs.at(0).vertexIndexes, streamedMeshs.at(0).vertexIndexes);
+	EXPECT_EQ(mappedMeshs.at(0).mtlIndex, streamedMeshs.at(0).mtlIndex);
+}
+
+TEST(ObjParserReadsFile, mappedFileRejectsDirectory) {
+	objParser::MappedFile mappedFile;
+
+	EXPECT_NE(mappedFile.open("../tests/TestAssets"), objParser::ErrorType::OK);
+	EXPECT_FALSE(mappedFile.isOpen());
+}
+
+TEST(ObjParserReadsFile, mappedFileViewsWholeFile) {
+	objParser::MappedFile mappedFile;
+
+	ASSERT_EQ(mappedFile.open("../tests/TestAssets/objTest1.obj"), objParser::ErrorType::OK);
+	ASSERT_TRUE(mappedFile.isOpen());
+
+	std::ifstream inFS("../tests/TestAssets/objTest1.obj", std::ios::binary);
+	std::string contents((std::istreambuf_iterator<char>(inFS)), std::istreambuf_iterator<char>());
+
+	EXPECT_EQ(mappedFile.view(), contents);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <string>
+
+constexpr std::string_view reserveTestObj =
+	"v 9 9 9\n"
+	"o a\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"vt 0 0\n"
+	"vt 1 0\n"
+	"vn 0 0 1\n"
+	"f 1/1 2/2 3/1\n"
+	"f -1/-1 -2/-2 -3/-1\n"
+	"o b\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"vn 0 1 0\n"
+	"  f 1//1 2//1 3//1\n"
+	"o c\n"
+	"v 1 2 3\n"
+	"v 4 5 6\n"
+	"v 7 8 9\n"
+	"vt 0 0\n"
+	"vn 1 0 0\n"
+	"f 1/1/1 2/1/1 3/1/1\n"
+	"f 1 2 3\n"
+	"o empty\n";
+
+namespace ReserveExactTestHelpers {
+	inline void expectExactCapacity(const objParser::Mesh& mesh) {
+		EXPECT_EQ(mesh.vertices.capacity(), mesh.vertices.size()) << mesh.name;
+		EXPECT_EQ(mesh.vertexTextureCoordinates.capacity(), mesh.vertexTextureCoordinates.size()) << mesh.name;
+		EXPECT_EQ(mesh.vertexNormals.capacity(), mesh.vertexNormals.size()) << mesh.name;
+		EXPECT_EQ(mesh.vertexIndexes.capacity(), mesh.vertexIndexes.size()) << mesh.name;
+		EXPECT_EQ(mesh.vertexTextureCoordinatesIndexes.capacity(), mesh.vertexTextureCoordinatesIndexes.size()) << mesh.name;
+		EXPECT_EQ(mesh.vertexNormalsIndexes.capacity(), mesh.vertexNormalsIndexes.size()) << mesh.name;
+	}
+}
+
+TEST(ObjParserReserveExact, reservesEachMeshOnce) {
+	objParser::ParseOptions options;
+	options.reserveExact = true;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	// the v before the first o goes onto the mesh thats already there
+	meshs.emplace_back("existing");
+	meshs.back().vertices.shrink_to_fit();
+
+	ASSERT_EQ(objParser::parseObjBuffer(reserveTestObj, "", meshs, materials, options), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 5);
+
+	for (const objParser::Mesh& mesh : meshs) {
+		ReserveExactTestHelpers::expectExactCapacity(mesh);
+	}
+
+	EXPECT_EQ(meshs.at(0).vertices.size(), 1);
+	EXPECT_EQ(meshs.at(1).vertexTextureCoordinatesIndexes.size(), 6);
+	EXPECT_EQ(meshs.at(2).vertexNormalsIndexes.size(), 3);
+}
+
+TEST(ObjParserReserveExact, matchesPlainParse) {
+	std::vector<objParser::Mesh> expectedMeshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer(reserveTestObj.substr(8), "", expectedMeshs, materials), objParser::ErrorType::OK);
+
+	for (unsigned threads : { 1u, 3u }) {
+		objParser::ParseOptions options;
+		options.reserveExact = true;
+		options.threadCount = threads;
+		options.minimumChunkSize = 1;
+
+		std::vector<objParser::Mesh> meshs;
+		ASSERT_EQ(objParser::parseObjBuffer(reserveTestObj.substr(8), "", meshs, materials, options), objParser::ErrorType::OK);
+		ASSERT_EQ(meshs.size(), expectedMeshs.size());
+
+		for (size_t i = 0; i < meshs.size(); i++) {
+			EXPECT_EQ(meshs[i].vertices, expectedMeshs[i].vertices);
+			EXPECT_EQ(meshs[i].vertexIndexes, expectedMeshs[i].vertexIndexes);
+			EXPECT_EQ(meshs[i].vertexTextureCoordinatesIndexes, expectedMeshs[i].vertexTextureCoordinatesIndexes);
+			EXPECT_EQ(meshs[i].vertexNormalsIndexes, expectedMeshs[i].vertexNormalsIndexes);
+
+			ReserveExactTestHelpers::expectExactCapacity(meshs[i]);
+		}
+	}
+}
\ No newline at end of file
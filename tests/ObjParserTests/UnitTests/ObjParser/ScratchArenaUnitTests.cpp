@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace ScratchArenaTestHelpers {
+	// one mesh, then the same few lines over and over
+	inline std::string makeRepeatingObj(size_t repeats) {
+		std::string contents = "o t\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvn 0 0 1\n";
+		for (size_t i = 0; i < repeats; i++) {
+			contents += "v 0.5 0.25 -1\nvt 0.5 0.5\nvn 0 1 0\nf 1/1/1 2/1/1 -1/-1/-1\n# a comment\n\n";
+		}
+		return contents;
+	}
+
+	inline objParser::ScratchStatistics parseBufferStatistics(const std::string& contents, objParser::ParseOptions options) {
+		objParser::ScratchStatistics statistics;
+		options.scratchStatistics = &statistics;
+
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+		EXPECT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+
+		return statistics;
+	}
+}
+
+TEST(ScratchArena, bumpsThroughInlineThenBlocks) {
+	objParser::ScratchArena arena;
+
+	void* first = arena.allocate(10, 1);
+	void* second = arena.allocate(8, 8);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % 8, 0);
+	EXPECT_GE(static_cast<std::byte*>(second), static_cast<std::byte*>(first) + 10);
+	EXPECT_EQ(arena.statistics().heapAllocations, 0);
+
+	// bigger than whats left inline, and bigger than the first block
+	void* big = arena.allocate(100 * 1024, 64);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(big) % 64, 0);
+	std::memset(big, 0xab, 100 * 1024);
+
+	EXPECT_EQ(arena.statistics().heapAllocations, 1);
+	EXPECT_EQ(arena.statistics().allocations, 3);
+	EXPECT_EQ(arena.statistics().bytes, 10 + 8 + 100 * 1024);
+
+	arena.release();
+	EXPECT_EQ(arena.allocate(10, 1), first);
+}
+
+TEST(ScratchArena, worksAsAPmrResource) {
+	objParser::ScratchArena arena;
+
+	std::pmr::vector<int> numbers(&arena);
+	for (int i = 0; i < 10000; i++) {
+		numbers.push_back(i);
+	}
+
+	EXPECT_EQ(numbers.back(), 9999);
+	EXPECT_GT(arena.statistics().allocations, 1);
+	// the blocks grow geometrically, so there are only a few of them
+	EXPECT_LE(arena.statistics().heapAllocations, 8);
+}
+
+TEST(ScratchArena, noHeapAllocationsPerLine) {
+	std::string small = ScratchArenaTestHelpers::makeRepeatingObj(10);
+	std::string large = ScratchArenaTestHelpers::makeRepeatingObj(20000);
+
+	objParser::ParseOptions options;
+	options.reserveExact = true;
+
+	// the scratch a buffer parse needs doesnt depend on how many lines there are, and fits inside the arena
+	objParser::ScratchStatistics smallStatistics = ScratchArenaTestHelpers::parseBufferStatistics(small, options);
+	objParser::ScratchStatistics largeStatistics = ScratchArenaTestHelpers::parseBufferStatistics(large, options);
+
+	EXPECT_GT(largeStatistics.allocations, 0);
+	EXPECT_EQ(largeStatistics.allocations, smallStatistics.allocations);
+	EXPECT_EQ(largeStatistics.heapAllocations, 0);
+
+	// the stream buffer is the only block, however long the file is
+	for (const std::string& contents : { small, large }) {
+		objParser::ScratchStatistics statistics;
+		options.scratchStatistics = &statistics;
+
+		std::istringstream stream(contents);
+		std::vector<objParser::Mesh> meshs;
+		std::vector<objParser::Material> materials;
+		ASSERT_EQ(objParser::parseObjStream(stream, "", meshs, materials, options), objParser::ErrorType::OK);
+
+		EXPECT_EQ(statistics.allocations, 1);
+		EXPECT_EQ(statistics.heapAllocations, 1);
+	}
+}
+
+TEST(ScratchArena, countsEveryChunk) {
+	std::string contents = ScratchArenaTestHelpers::makeRepeatingObj(2000);
+
+	objParser::ParseOptions options;
+	options.reserveExact = true;
+	options.threadCount = 4;
+	options.minimumChunkSize = 1;
+
+	objParser::ScratchStatistics statistics = ScratchArenaTestHelpers::parseBufferStatistics(contents, options);
+
+	// the chunk list, summaries, starts, results and thread bookkeeping, then a reservation list per chunk
+	EXPECT_GE(statistics.allocations, 4 + 4);
+	EXPECT_EQ(statistics.heapAllocations, 0);
+}
+
+TEST(ScratchArena, earClippingReusesItsScratch) {
+	// a concave hexagon over and over, every one of them is ear clipped
+	auto makeConcaveObj = [](size_t repeats) {
+		std::string contents = "o t\n";
+		for (size_t i = 0; i < repeats; i++) {
+			contents += "v 0 0 0\nv 4 0 0\nv 4 4 0\nv 2 1 0\nv 0 4 0\nv -1 2 0\nf -6 -5 -4 -3 -2 -1\n";
+		}
+		return contents;
+	};
+
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::earClipping;
+
+	objParser::ScratchStatistics smallStatistics = ScratchArenaTestHelpers::parseBufferStatistics(makeConcaveObj(10), options);
+	objParser::ScratchStatistics largeStatistics = ScratchArenaTestHelpers::parseBufferStatistics(makeConcaveObj(20000), options);
+
+	EXPECT_EQ(largeStatistics.allocations, smallStatistics.allocations);
+	EXPECT_EQ(largeStatistics.heapAllocations, smallStatistics.heapAllocations);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+constexpr std::string_view soaTestObj =
+	"o a\n"
+	"v 1 2 3\n"
+	"v 4 5 6 2\n"
+	"v 7 8 9\n"
+	"vt 0.25 0.5\n"
+	"vn 0 0 2\n"
+	"f 1/1/1 -2/-1/-1 3/1/1\n"
+	"o b\n"
+	"v -1 -2 -3\n"
+	"v 1 1 1\n"
+	"v 0 0 0\n"
+	"f -3 -2 -1\n";
+
+namespace SoaLayoutTestHelpers {
+	// the soa arrays have to hold exactly what the glm vectors would have
+	inline void expectSameAttribute(const objParser::AttributeArrays& arrays, const std::vector<glm::vec3>& vectors) {
+		ASSERT_EQ(arrays.size(), vectors.size());
+		ASSERT_EQ(arrays.x().size(), vectors.size());
+		ASSERT_EQ(arrays.y().size(), vectors.size());
+		ASSERT_EQ(arrays.z().size(), vectors.size());
+
+		for (size_t i = 0; i < vectors.size(); i++) {
+			EXPECT_EQ(arrays.x()[i], vectors[i].x);
+			EXPECT_EQ(arrays.y()[i], vectors[i].y);
+			EXPECT_EQ(arrays.z()[i], vectors[i].z);
+		}
+	}
+
+	inline void expectSameMeshs(const std::vector<objParser::Mesh>& soaMeshs, const std::vector<objParser::Mesh>& aosMeshs) {
+		ASSERT_EQ(soaMeshs.size(), aosMeshs.size());
+
+		for (size_t i = 0; i < aosMeshs.size(); i++) {
+			const objParser::Mesh& soa = soaMeshs[i];
+			const objParser::Mesh& aos = aosMeshs[i];
+
+			// the other layout is never touched
+			EXPECT_TRUE(soa.vertices.empty());
+			EXPECT_TRUE(soa.vertexTextureCoordinates.empty());
+			EXPECT_TRUE(soa.vertexNormals.empty());
+			EXPECT_TRUE(aos.vertexArrays.empty());
+
+			SoaLayoutTestHelpers::expectSameAttribute(soa.vertexArrays, aos.vertices);
+			SoaLayoutTestHelpers::expectSameAttribute(soa.vertexTextureCoordinateArrays, aos.vertexTextureCoordinates);
+			SoaLayoutTestHelpers::expectSameAttribute(soa.vertexNormalArrays, aos.vertexNormals);
+
+			EXPECT_EQ(soa.vertexIndexes, aos.vertexIndexes);
+			EXPECT_EQ(soa.vertexTextureCoordinatesIndexes, aos.vertexTextureCoordinatesIndexes);
+			EXPECT_EQ(soa.vertexNormalsIndexes, aos.vertexNormalsIndexes);
+		}
+	}
+}
+
+TEST(ObjParserSoaLayout, matchesArrayOfStructs) {
+	std::vector<objParser::Mesh> aosMeshs;
+	std::vector<objParser::Material> materials;
+	ASSERT_EQ(objParser::parseObjBuffer(soaTestObj, "", aosMeshs, materials), objParser::ErrorType::OK);
+
+	objParser::ParseOptions options;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+
+	std::vector<objParser::Mesh> bufferMeshs;
+	ASSERT_EQ(objParser::parseObjBuffer(soaTestObj, "", bufferMeshs, materials, options), objParser::ErrorType::OK);
+	SoaLayoutTestHelpers::expectSameMeshs(bufferMeshs, aosMeshs);
+
+	std::istringstream stream{ std::string(soaTestObj) };
+	std::vector<objParser::Mesh> streamMeshs;
+	ASSERT_EQ(objParser::parseObjStream(stream, "", streamMeshs, materials, options), objParser::ErrorType::OK);
+	SoaLayoutTestHelpers::expectSameMeshs(streamMeshs, aosMeshs);
+
+	// and with the other options that touch the attribute vectors
+	options.threadCount = 3;
+	options.minimumChunkSize = 1;
+	options.reserveExact = true;
+
+	std::vector<objParser::Mesh> parallelMeshs;
+	ASSERT_EQ(objParser::parseObjBuffer(soaTestObj, "", parallelMeshs, materials, options), objParser::ErrorType::OK);
+	SoaLayoutTestHelpers::expectSameMeshs(parallelMeshs, aosMeshs);
+}
+
+TEST(ObjParserSoaLayout, checksIndicesAgainstArrays) {
+	objParser::ParseOptions options;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	EXPECT_EQ(objParser::parseObjBuffer("o t\nv 1 2 3\nv 1 2 3\nf 1 2 3", "", meshs, materials, options), objParser::ErrorType::FileFormatError);
+}
+
+TEST(ObjParserSoaLayout, spansWriteThrough) {
+	objParser::AttributeArrays arrays;
+	arrays.push_back(1, 2, 3);
+
+	arrays.y()[0] = 5;
+
+	EXPECT_EQ(arrays.ys.at(0), 5);
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string_view>
+
+TEST(LineTokenizer, readsTokensAndNumbers) {
+	objParser::LineTokenizer tokens("  v\t1.5 -2 +3e1 7\r");
+
+	std::string_view token;
+	float x = 0, y = 0, z = 0;
+	int i = 0;
+
+	ASSERT_TRUE(tokens.next(token));
+	EXPECT_EQ(token, "v");
+	ASSERT_TRUE(tokens.next(x));
+	ASSERT_TRUE(tokens.next(y));
+	ASSERT_TRUE(tokens.next(z));
+	ASSERT_TRUE(tokens.next(i));
+
+	EXPECT_EQ(x, 1.5f);
+	EXPECT_EQ(y, -2.0f);
+	EXPECT_EQ(z, 30.0f);
+	EXPECT_EQ(i, 7);
+	EXPECT_TRUE(tokens.atEnd());
+	EXPECT_FALSE(tokens.fail());
+}
+
+TEST(LineTokenizer, failureIsSticky) {
+	objParser::LineTokenizer tokens("1 a 2");
+
+	float x = 0, y = 0, z = 0;
+
+	EXPECT_TRUE(tokens.next(x));
+	EXPECT_FALSE(tokens.next(y));
+	EXPECT_FALSE(tokens.next(z));
+	EXPECT_TRUE(tokens.fail());
+
+	// failed reads dont touch the value
+	EXPECT_EQ(z, 0.0f);
+}
+
+TEST(LineTokenizer, stopsNumbersAtNonNumbers) {
+	objParser::LineTokenizer tokens("12/34");
+
+	int v = 0;
+	std::string_view rest;
+
+	ASSERT_TRUE(tokens.next(v));
+	EXPECT_EQ(v, 12);
+	ASSERT_TRUE(tokens.next(rest));
+	EXPECT_EQ(rest, "/34");
+}
+
+TEST(LineTokenizer, rejectsOutOfRangeInts) {
+	objParser::LineTokenizer tokens("99999999999");
+
+	int v = 0;
+	EXPECT_FALSE(tokens.next(v));
+}
+
+TEST(LineTokenizer, rejectsExponentWithoutDigits) {
+	// operator>> fails on these, so the tokenizer has to as well
+	for (std::string_view number : { "1e", "1e+", "2E-", "4.E+", "0.5 1e" }) {
+		objParser::LineTokenizer tokens(number);
+
+		float value = 0.0f;
+		while (tokens.next(value)) {}
+
+		EXPECT_TRUE(tokens.fail()) << number;
+		EXPECT_FALSE(tokens.atEnd()) << number;
+	}
+}
+
+TEST(ChunkedLineReader, splitsLinesAcrossChunks) {
+	std::istringstream stream("o first\nv 1 2 3\n\na line that is much longer than the chunk\nlast");
+	objParser::ChunkedLineReader reader(stream, 4);
+
+	std::vector<std::string> lines;
+	std::string_view line;
+	while (reader.nextLine(line)) {
+		lines.emplace_back(line);
+	}
+
+	EXPECT_EQ(lines, std::vector<std::string>({ "o first", "v 1 2 3", "", "a line that is much longer than the chunk", "last" }));
+}
+
+TEST(ChunkedLineReader, dropsEmptyLastLine) {
+	std::istringstream stream("a\nb\n");
+	objParser::ChunkedLineReader reader(stream);
+
+	std::vector<std::string> lines;
+	std::string_view line;
+	while (reader.nextLine(line)) {
+		lines.emplace_back(line);
+	}
+
+	EXPECT_EQ(lines, std::vector<std::string>({ "a", "b" }));
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace TriangulateTestHelpers {
+	// an L, the corner at (1, 1) is reflex
+	const std::vector<glm::vec3> lShape = { { 0, 0, 0 }, { 2, 0, 0 }, { 2, 1, 0 }, { 1, 1, 0 }, { 1, 2, 0 }, { 0, 2, 0 } };
+
+	// a comb with 4 teeth sticking up, half the corners are reflex
+	inline std::vector<glm::vec3> makeComb() {
+		std::vector<glm::vec3> comb = { { 0, 0, 0 }, { 8, 0, 0 } };
+		for (int tooth = 3; tooth >= 0; tooth--) {
+			comb.push_back({ tooth * 2 + 2, 3, 0 });
+			comb.push_back({ tooth * 2 + 1, 3, 0 });
+			comb.push_back({ tooth * 2 + 1, 1, 0 });
+			comb.push_back({ tooth * 2, 1, 0 });
+		}
+		comb.pop_back();
+		return comb;
+	}
+
+	inline float signedArea(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+		return ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) * 0.5f;
+	}
+
+	inline float polygonArea(std::span<const glm::vec3> positions) {
+		float area = 0.0f;
+		for (size_t i = 0; i < positions.size(); i++) {
+			const glm::vec3& a = positions[i];
+			const glm::vec3& b = positions[(i + 1) % positions.size()];
+			area += a.x * b.y - b.x * a.y;
+		}
+		return area * 0.5f;
+	}
+
+	// every triangle winds the same way as the polygon and together they cover exactly it
+	inline void expectCovers(std::span<const glm::vec3> positions, std::span<const uint32_t> triangles) {
+		ASSERT_EQ(triangles.size(), 3 * (positions.size() - 2));
+
+		float area = 0.0f;
+		for (size_t i = 0; i < triangles.size(); i += 3) {
+			ASSERT_LT(triangles[i], positions.size());
+			ASSERT_LT(triangles[i + 1], positions.size());
+			ASSERT_LT(triangles[i + 2], positions.size());
+
+			float triangleArea = signedArea(positions[triangles[i]], positions[triangles[i + 1]], positions[triangles[i + 2]]);
+			EXPECT_GT(triangleArea, 0.0f);
+			area += triangleArea;
+		}
+		EXPECT_FLOAT_EQ(area, polygonArea(positions));
+	}
+
+	// one object with all its positions up front, then a lot of polygons that reach back to them
+	inline std::string makePolygonFile(std::span<const glm::vec3> positions, int polygonCount) {
+		std::string contents = "o t\n";
+		for (const glm::vec3& position : positions) {
+			contents += "v " + std::to_string(position.x) + " " + std::to_string(position.y) + " " + std::to_string(position.z) + "\n";
+		}
+		for (int i = 0; i < polygonCount; i++) {
+			contents += "f";
+			for (size_t corner = 0; corner < positions.size(); corner++) {
+				contents += " " + std::to_string((corner + i) % positions.size() + 1);
+			}
+			contents += "\n";
+		}
+		return contents;
+	}
+}
+
+TEST(Triangulate, fansAConvexQuad) {
+	const std::vector<glm::vec3> square = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } };
+	std::vector<uint32_t> triangles(6);
+
+	objParser::triangulatePolygon(square, triangles);
+	EXPECT_EQ(triangles, std::vector<uint32_t>({ 0, 1, 2, 0, 2, 3 }));
+
+	objParser::fanPolygon(square.size(), triangles);
+	EXPECT_EQ(triangles, std::vector<uint32_t>({ 0, 1, 2, 0, 2, 3 }));
+}
+
+TEST(Triangulate, splitsAConcaveQuadAtItsReflexCorner) {
+	// a dart, corner 3 points inwards so the 0 - 2 diagonal would leave the quad
+	const std::vector<glm::vec3> dart = { { 0, 0, 0 }, { 4, 2, 0 }, { 0, 4, 0 }, { 1, 2, 0 } };
+	std::vector<uint32_t> triangles(6);
+
+	objParser::triangulatePolygon(dart, triangles);
+	TriangulateTestHelpers::expectCovers(dart, triangles);
+	EXPECT_EQ(triangles, std::vector<uint32_t>({ 3, 0, 1, 3, 1, 2 }));
+}
+
+TEST(Triangulate, earClipsConcavePolygons) {
+	std::vector<uint32_t> triangles(3 * (TriangulateTestHelpers::lShape.size() - 2));
+	objParser::triangulatePolygon(TriangulateTestHelpers::lShape, triangles);
+	TriangulateTestHelpers::expectCovers(TriangulateTestHelpers::lShape, triangles);
+
+	std::vector<glm::vec3> comb = TriangulateTestHelpers::makeComb();
+	triangles.resize(3 * (comb.size() - 2));
+	objParser::triangulatePolygon(comb, triangles);
+	TriangulateTestHelpers::expectCovers(comb, triangles);
+
+	// clockwise and standing up in the yz plane is still the same polygon
+	std::vector<glm::vec3> flipped;
+	for (auto it = comb.rbegin(); it != comb.rend(); it++) {
+		flipped.push_back({ 0, it->x, it->y });
+	}
+	objParser::triangulatePolygon(flipped, triangles);
+
+	std::vector<glm::vec3> unflipped;
+	for (const glm::vec3& position : flipped) {
+		unflipped.push_back({ position.z, position.y, 0 });
+	}
+	TriangulateTestHelpers::expectCovers(unflipped, triangles);
+}
+
+TEST(Triangulate, noneStillRejectsPolygons) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	EXPECT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3 4", "", meshs, materials), objParser::ErrorType::FileFormatError);
+}
+
+TEST(Triangulate, fansFacesWithEveryAttribute) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::fan;
+
+	std::string contents = "o t\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 2 0\nvt 0 0\nvt 1 1\nvn 0 0 1\nvn 0 1 0\nf 1/1/1 2/2/2 3/1/2 4/2/1 5/1/1\nf 1/2/1 2/2/1 3/2/1\n";
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 1);
+
+	EXPECT_EQ(meshs.at(0).vertexIndexes, std::vector<int>({ 0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 1, 2 }));
+	EXPECT_EQ(meshs.at(0).vertexTextureCoordinatesIndexes, std::vector<int>({ 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 1, 1 }));
+	EXPECT_EQ(meshs.at(0).vertexNormalsIndexes, std::vector<int>({ 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0 }));
+}
+
+TEST(Triangulate, earClipsWhileParsing) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	objParser::ParseOptions options;
+	options.triangulation = objParser::Triangulation::earClipping;
+	options.reserveExact = true;
+
+	std::string contents = TriangulateTestHelpers::makePolygonFile(TriangulateTestHelpers::lShape, 1);
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+	ASSERT_EQ(meshs.size(), 1);
+
+	const objParser::Mesh& mesh = meshs.at(0);
+	std::vector<uint32_t> triangles(mesh.vertexIndexes.begin(), mesh.vertexIndexes.end());
+	TriangulateTestHelpers::expectCovers(TriangulateTestHelpers::lShape, triangles);
+	EXPECT_EQ(mesh.vertexIndexes.capacity(), mesh.vertexIndexes.size());
+}
+
+TEST(Triangulate, sameForEveryWayOfParsing) {
+	std::string contents = TriangulateTestHelpers::makePolygonFile(TriangulateTestHelpers::makeComb(), 200);
+
+	for (objParser::FaceIndexing faceIndexing : { objParser::FaceIndexing::perObject, objParser::FaceIndexing::fileWide }) {
+		objParser::ParseOptions options;
+		options.triangulation = objParser::Triangulation::earClipping;
+		options.faceIndexing = faceIndexing;
+
+		std::vector<objParser::Mesh> expected;
+		std::vector<objParser::Material> materials;
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "", expected, materials, options), objParser::ErrorType::OK);
+
+		// polygons in later chunks only have their positions after the stitch, the result has to be the same anyway
+		objParser::ParseOptions threadedOptions = options;
+		threadedOptions.threadCount = 4;
+		threadedOptions.minimumChunkSize = 1;
+
+		std::vector<objParser::Mesh> threaded;
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "", threaded, materials, threadedOptions), objParser::ErrorType::OK);
+
+		std::istringstream stream(contents);
+		std::vector<objParser::Mesh> streamed;
+		ASSERT_EQ(objParser::parseObjStream(stream, "", streamed, materials, options), objParser::ErrorType::OK);
+
+		ASSERT_EQ(threaded.size(), 1);
+		ASSERT_EQ(streamed.size(), 1);
+		EXPECT_EQ(threaded.at(0).vertexIndexes, expected.at(0).vertexIndexes);
+		EXPECT_EQ(streamed.at(0).vertexIndexes, expected.at(0).vertexIndexes);
+		EXPECT_EQ(threaded.at(0).vertices, expected.at(0).vertices);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+namespace VertexBufferTestHelpers {
+	// the welded buffer has to draw exactly the same triangles as the three index lists
+	inline void expectSameCorners(const objParser::Mesh& mesh, const objParser::VertexBuffer& vertexBuffer) {
+		const objParser::VertexLayout& layout = vertexBuffer.layout;
+		size_t stride = layout.stride();
+		size_t positionOffset = layout.offset(objParser::VertexAttribute::position);
+		size_t textureOffset = layout.offset(objParser::VertexAttribute::textureCoordinate);
+		size_t normalOffset = layout.offset(objParser::VertexAttribute::normal);
+
+		ASSERT_EQ(vertexBuffer.indices.size(), mesh.vertexIndexes.size());
+
+		for (size_t i = 0; i < vertexBuffer.indices.size(); i++) {
+			ASSERT_LT(vertexBuffer.indices[i], vertexBuffer.vertexCount());
+			const float* vertex = vertexBuffer.vertices.data() + vertexBuffer.indices[i] * stride;
+
+			EXPECT_EQ(glm::vec3(vertex[positionOffset], vertex[positionOffset + 1], vertex[positionOffset + 2]), mesh.vertices[mesh.vertexIndexes[i]]);
+
+			if (!mesh.vertexTextureCoordinatesIndexes.empty()) {
+				const glm::vec3& textureCoordinate = mesh.vertexTextureCoordinates[mesh.vertexTextureCoordinatesIndexes[i]];
+				EXPECT_EQ(vertex[textureOffset], textureCoordinate.x);
+				EXPECT_EQ(vertex[textureOffset + 1], textureCoordinate.y);
+			}
+
+			if (!mesh.vertexNormalsIndexes.empty()) {
+				EXPECT_EQ(glm::vec3(vertex[normalOffset], vertex[normalOffset + 1], vertex[normalOffset + 2]), mesh.vertexNormals[mesh.vertexNormalsIndexes[i]]);
+			}
+		}
+	}
+}
+
+TEST(VertexBuffer, weldsSharedCorners) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	// a quad, the two triangles share two corners
+	constexpr std::string_view contents =
+		"o quad\n"
+		"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+		"vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+		"vn 0 0 1\n"
+		"f 1/1/1 2/2/1 3/3/1\n"
+		"f 1/1/1 3/3/1 4/4/1\n";
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::VertexBuffer vertexBuffer;
+	ASSERT_EQ(objParser::buildVertexBuffer(meshs.at(0), vertexBuffer), objParser::ErrorType::OK);
+
+	EXPECT_EQ(vertexBuffer.layout.stride(), 8);
+	EXPECT_EQ(vertexBuffer.vertexCount(), 4);
+	EXPECT_EQ(vertexBuffer.indices, std::vector<uint32_t>({ 0,1,2,0,2,3 }));
+
+	VertexBufferTestHelpers::expectSameCorners(meshs.at(0), vertexBuffer);
+}
+
+TEST(VertexBuffer, keepsCornersThatOnlyShareAPosition) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	// a uv seam, same position but a different uv has to be its own vertex
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvt 1 1\nf 1/1 2/1 3/1\nf 1/2 2/1 3/1", "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::VertexBuffer vertexBuffer;
+	ASSERT_EQ(objParser::buildVertexBuffer(meshs.at(0), vertexBuffer), objParser::ErrorType::OK);
+
+	EXPECT_EQ(vertexBuffer.vertexCount(), 4);
+	EXPECT_EQ(vertexBuffer.indices, std::vector<uint32_t>({ 0,1,2,3,1,2 }));
+
+	// the mesh has no normals, so they come out as zeros
+	for (size_t vertex = 0; vertex < vertexBuffer.vertexCount(); vertex++) {
+		EXPECT_EQ(vertexBuffer.vertices[vertex * 8 + 5], 0.0f);
+		EXPECT_EQ(vertexBuffer.vertices[vertex * 8 + 7], 0.0f);
+	}
+}
+
+TEST(VertexBuffer, followsTheLayout) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 1 2 3\nv 4 5 6\nv 7 8 9\nvt 0.1 0.2 0.3\nvn 0 1 0\nf 1/1/1 2/1/1 3/1/1", "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::VertexLayout layout;
+	layout.attributes = { objParser::VertexAttribute::normal, objParser::VertexAttribute::textureCoordinate, objParser::VertexAttribute::position };
+	layout.textureCoordinateComponents = 3;
+
+	EXPECT_EQ(layout.stride(), 9);
+	EXPECT_EQ(layout.offset(objParser::VertexAttribute::normal), 0);
+	EXPECT_EQ(layout.offset(objParser::VertexAttribute::textureCoordinate), 3);
+	EXPECT_EQ(layout.offset(objParser::VertexAttribute::position), 6);
+
+	objParser::VertexBuffer vertexBuffer;
+	ASSERT_EQ(objParser::buildVertexBuffer(meshs.at(0), vertexBuffer, layout), objParser::ErrorType::OK);
+
+	EXPECT_EQ(std::vector<float>(vertexBuffer.vertices.begin(), vertexBuffer.vertices.begin() + 9), std::vector<float>({ 0, 1, 0, 0.1f, 0.2f, 0.3f, 1, 2, 3 }));
+
+	layout.attributes = { objParser::VertexAttribute::position };
+	EXPECT_EQ(layout.offset(objParser::VertexAttribute::normal), objParser::VertexLayout::npos);
+}
+
+TEST(VertexBuffer, rejectsMixedFaceFormats) {
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+
+	ASSERT_EQ(objParser::parseObjBuffer("o t\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nf 1/1 2/1 3/1\nf 1 2 3", "", meshs, materials), objParser::ErrorType::OK);
+
+	objParser::VertexBuffer vertexBuffer;
+	EXPECT_EQ(objParser::buildVertexBuffer(meshs.at(0), vertexBuffer), objParser::ErrorType::FileFormatError);
+}
+
+TEST(VertexBuffer, readsStructOfArrays) {
+	constexpr std::string_view contents = "o t\nv 1 2 3\nv 4 5 6\nv 7 8 9\nvn 0 0 1\nf 1//1 2//1 3//1\nf 3//1 2//1 1//1";
+
+	std::vector<objParser::Mesh> aosMeshs;
+	std::vector<objParser::Mesh> soaMeshs;
+	std::vector<objParser::Material> materials;
+
+	objParser::ParseOptions options;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", aosMeshs, materials), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", soaMeshs, materials, options), objParser::ErrorType::OK);
+
+	objParser::VertexBuffer aosBuffer;
+	objParser::VertexBuffer soaBuffer;
+	ASSERT_EQ(objParser::buildVertexBuffer(aosMeshs.at(0), aosBuffer), objParser::ErrorType::OK);
+	ASSERT_EQ(objParser::buildVertexBuffer(soaMeshs.at(0), soaBuffer), objParser::ErrorType::OK);
+
+	EXPECT_EQ(soaBuffer.vertices, aosBuffer.vertices);
+	EXPECT_EQ(soaBuffer.indices, aosBuffer.indices);
+}
+
+TEST(VertexBuffer, buildsEveryMeshOnThreads) {
+	// enough random corners that the table has to grow a few times
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<int> pick(1, 40);
+
+	std::string contents;
+	for (int mesh = 0; mesh < 9; mesh++) {
+		contents += "o m" + std::to_string(mesh) + "\n";
+		for (int i = 0; i < 40; i++) {
+			contents += "v " + std::to_string(i) + " " + std::to_string(mesh) + " 0\nvt 0 " + std::to_string(i) + "\nvn 1 0 " + std::to_string(i) + "\n";
+		}
+		for (int face = 0; face < 500 * (mesh + 1); face++) {
+			contents += "f";
+			for (int corner = 0; corner < 3; corner++) {
+				contents += " " + std::to_string(pick(rng)) + "/" + std::to_string(pick(rng) % 4 + 1) + "/" + std::to_string(pick(rng) % 2 + 1);
+			}
+			contents += "\n";
+		}
+	}
+
+	std::vector<objParser::Mesh> meshs;
+	std::vector<objParser::Material> materials;
+	ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+
+	std::vector<objParser::VertexBuffer> vertexBuffers;
+	ASSERT_EQ(objParser::buildVertexBuffers(meshs, vertexBuffers, {}, 4), objParser::ErrorType::OK);
+	ASSERT_EQ(vertexBuffers.size(), meshs.size());
+
+	for (size_t i = 0; i < meshs.size(); i++) {
+		VertexBufferTestHelpers::expectSameCorners(meshs[i], vertexBuffers[i]);
+
+		// 40 positions * 4 uvs * 2 normals is the most there can be
+		EXPECT_LE(vertexBuffers[i].vertexCount(), 320);
+	}
+}
\ No newline at end of file
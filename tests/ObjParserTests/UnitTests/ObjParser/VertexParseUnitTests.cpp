@@ -73,6 +73,7 @@ INSTANTIATE_TEST_SUITE_P(
 		VertexParseCase{ "v 1.0 1.0 1.0 .5 1.0 1.0 1.0",true,		glm::vec3(2.0f, 2.0f, 2.0f) },		// ACCEPTS a bunch of numbers (some programs use them to specify rgb, so its still valid im just ignoring it)
 		
 		VertexParseCase{ "v a 1.0 1.0 .5",				true,		glm::vec3(), objParser::ErrorType::FileFormatError },	// REJECTS letter instead of number
-		VertexParseCase{ "v 1 1.0 b .5",				true,		glm::vec3(), objParser::ErrorType::FileFormatError }		// REJECTS letter instead of number
+		VertexParseCase{ "v 1 1.0 b .5",				true,		glm::vec3(), objParser::ErrorType::FileFormatError },	// REJECTS letter instead of number
+		VertexParseCase{ "v 1 2 3e",					true,		glm::vec3(), objParser::ErrorType::FileFormatError }		// REJECTS exponent with no digits
 	)
 );
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace PmrTestHelpers {
+	// anything that quietly falls back to the default resource throws instead of passing
+	class ScopedNullDefaultResource {
+	public:
+		ScopedNullDefaultResource() : previous(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+		~ScopedNullDefaultResource() {
+			std::pmr::set_default_resource(previous);
+		}
+
+	private:
+		std::pmr::memory_resource* previous;
+	};
+
+	inline std::string makeObj(size_t meshCount) {
+		std::string contents;
+		for (size_t i = 0; i < meshCount; i++) {
+			contents += "o mesh_with_a_name_too_long_for_the_small_string_" + std::to_string(i) + "\n";
+			contents += "v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvn 0 0 1\n";
+			contents += "f -3/1/1 -2/1/1 -1/1/1\n";
+		}
+		return contents;
+	}
+
+	inline void expectAllIn(const objParser::Vector<objParser::Mesh>& meshs, std::pmr::memory_resource* resource) {
+		for (const objParser::Mesh& mesh : meshs) {
+			EXPECT_EQ(mesh.name.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertices.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexTextureCoordinates.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexNormals.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexArrays.xs.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexNormalArrays.zs.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexIndexes.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexTextureCoordinatesIndexes.get_allocator().resource(), resource);
+			EXPECT_EQ(mesh.vertexNormalsIndexes.get_allocator().resource(), resource);
+		}
+	}
+}
+
+TEST(Pmr, usesTheVectorsResource) {
+	static_assert(std::is_same_v<decltype(objParser::Mesh::vertices), std::pmr::vector<glm::vec3>>);
+	static_assert(std::uses_allocator_v<objParser::Mesh, std::pmr::polymorphic_allocator<objParser::Mesh>>);
+
+	std::pmr::monotonic_buffer_resource pool;
+	objParser::Vector<objParser::Mesh> meshs(&pool);
+	objParser::Vector<objParser::Material> materials(&pool);
+
+	{
+		PmrTestHelpers::ScopedNullDefaultResource nullDefault;
+		ASSERT_EQ(objParser::parseObjBuffer(PmrTestHelpers::makeObj(20), "", meshs, materials), objParser::ErrorType::OK);
+	}
+
+	ASSERT_EQ(meshs.size(), 20);
+	EXPECT_EQ(meshs.at(19).name, "mesh_with_a_name_too_long_for_the_small_string_19");
+	EXPECT_EQ(meshs.at(19).vertexIndexes, objParser::Vector<objParser::Index>({ 0, 1, 2 }));
+	PmrTestHelpers::expectAllIn(meshs, &pool);
+}
+
+TEST(Pmr, usesTheVectorsResourceAcrossThreads) {
+	std::string contents = PmrTestHelpers::makeObj(2000);
+
+	std::vector<objParser::Mesh> expected;
+	{
+		std::pmr::monotonic_buffer_resource pool;
+		objParser::Vector<objParser::Mesh> meshs(&pool);
+		objParser::Vector<objParser::Material> materials(&pool);
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials), objParser::ErrorType::OK);
+		ASSERT_EQ(meshs.size(), 2000);
+	}
+
+	std::pmr::synchronized_pool_resource pool;
+	objParser::Vector<objParser::Mesh> meshs(&pool);
+	objParser::Vector<objParser::Material> materials(&pool);
+
+	objParser::ParseOptions options;
+	options.threadCount = 4;
+
+	{
+		PmrTestHelpers::ScopedNullDefaultResource nullDefault;
+		ASSERT_EQ(objParser::parseObjBuffer(contents, "", meshs, materials, options), objParser::ErrorType::OK);
+	}
+
+	ASSERT_EQ(meshs.size(), 2000);
+	EXPECT_EQ(meshs.at(1234).name, "mesh_with_a_name_too_long_for_the_small_string_1234");
+	EXPECT_EQ(meshs.at(1234).vertexNormalsIndexes, objParser::Vector<objParser::Index>({ 0, 0, 0 }));
+	PmrTestHelpers::expectAllIn(meshs, &pool);
+}
+
+TEST(Pmr, usesTheVectorsResourceForStreams) {
+	std::istringstream stream(PmrTestHelpers::makeObj(5));
+
+	std::pmr::monotonic_buffer_resource pool;
+	objParser::Vector<objParser::Mesh> meshs(&pool);
+	objParser::Vector<objParser::Material> materials(&pool);
+
+	objParser::ParseOptions options;
+	options.layout = objParser::AttributeLayout::structOfArrays;
+
+	{
+		PmrTestHelpers::ScopedNullDefaultResource nullDefault;
+		ASSERT_EQ(objParser::parseObjStream(stream, "", meshs, materials, options), objParser::ErrorType::OK);
+	}
+
+	ASSERT_EQ(meshs.size(), 5);
+	EXPECT_EQ(meshs.at(4).vertexArrays.ys, objParser::Vector<float>({ 0, 0, 1 }));
+	PmrTestHelpers::expectAllIn(meshs, &pool);
+}
+
+TEST(Pmr, materialsUseTheVectorsResource) {
+	std::istringstream stream("newmtl a_material_with_a_name_too_long_for_the_small_string\nKd 1 0.5 0\nd 0.5\n");
+
+	std::pmr::monotonic_buffer_resource pool;
+	objParser::Vector<objParser::Material> materials(&pool);
+
+	{
+		PmrTestHelpers::ScopedNullDefaultResource nullDefault;
+		ASSERT_EQ(objParser::parseMtlStream(stream, "", materials), objParser::ErrorType::OK);
+	}
+
+	ASSERT_EQ(materials.size(), 1);
+	EXPECT_EQ(materials.at(0).name, "a_material_with_a_name_too_long_for_the_small_string");
+	EXPECT_EQ(materials.at(0).name.get_allocator().resource(), &pool);
+	EXPECT_EQ(materials.at(0).diffuseColor, glm::vec3(1.0f, 0.5f, 0.0f));
+}
+
+TEST(Pmr, copiesKeepTheirOwnResource) {
+	std::pmr::monotonic_buffer_resource pool;
+	objParser::Vector<objParser::Mesh> meshs(&pool);
+	objParser::Vector<objParser::Material> materials(&pool);
+	ASSERT_EQ(objParser::parseObjBuffer(PmrTestHelpers::makeObj(2), "", meshs, materials), objParser::ErrorType::OK);
+
+	std::pmr::monotonic_buffer_resource otherPool;
+	objParser::Vector<objParser::Mesh> copies(meshs, &otherPool);
+
+	ASSERT_EQ(copies.size(), 2);
+	EXPECT_EQ(copies.at(1).name, meshs.at(1).name);
+	EXPECT_EQ(copies.at(1).vertices, meshs.at(1).vertices);
+	PmrTestHelpers::expectAllIn(copies, &otherPool);
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+// the parser with every heap allocation counted, in a build of its own so the rest of the tests keep the normal operator new
+
+#define OBJ_PARSER_IMPLEMENTATION
+#include "../obj_parser/obj_parser.hpp"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace AllocationTestHelpers {
+	// only counts while counting is set, so gtest's own allocations dont get in the way
+	inline std::atomic<bool> counting = false;
+	inline std::atomic<size_t> allocations = 0;
+}
+
+// kept out of line, so the compiler never sees a free matched up with the new it came from
+[[gnu::noinline]] void* operator new(std::size_t size) {
+	if (AllocationTestHelpers::counting) {
+		AllocationTestHelpers::allocations++;
+	}
+
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+[[gnu::noinline]] void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+#include "ObjParserTests/UnitTests/Allocation/AllocationUnitTests.cpp"
\ No newline at end of file
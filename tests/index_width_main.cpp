@@ -0,0 +1,10 @@
+// the parser built with 16 bit indices, the same way a user would pick them
+
+#include <cstdint>
+#define OBJ_PARSER_INDEX_TYPE uint16_t
+
+#define OBJ_PARSER_IMPLEMENTATION
+#include "../obj_parser/obj_parser.hpp"
+#include <gtest/gtest.h>
+
+#include "ObjParserTests/UnitTests/IndexWidth/IndexWidthUnitTests.cpp"
\ No newline at end of file
@@ -0,0 +1,9 @@
+// the parser built on std::pmr, the same way a user would turn it on
+
+#define OBJ_PARSER_PMR
+
+#define OBJ_PARSER_IMPLEMENTATION
+#include "../obj_parser/obj_parser.hpp"
+#include <gtest/gtest.h>
+
+#include "ObjParserTests/UnitTests/Pmr/PmrUnitTests.cpp"
\ No newline at end of file
@@ -10,8 +10,26 @@
 #include "ObjParserTests/UnitTests/MtlParser/MtlParserUnitTestsFloat.cpp"
 #include "ObjParserTests/UnitTests/MtlParser/MtlParserUnitTestsVec.cpp"
 
+#include "ObjParserTests/UnitTests/ObjParser/AttributeMaskUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/BinaryCacheUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/BufferParseUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/ByteScannerUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/EventParserUnitTests.cpp"
 #include "ObjParserTests/UnitTests/ObjParser/FaceParseUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/FileWideIndexUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/MaterialRangeUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/MeshGeneratorUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/NumberParseUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/ParallelParseUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/ParseCacheUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/QuantizeUnitTests.cpp"
 #include "ObjParserTests/UnitTests/ObjParser/ReadsFile.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/ReserveExactUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/ScratchArenaUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/SoaLayoutUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/TokenizerUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/TriangulateUnitTests.cpp"
+#include "ObjParserTests/UnitTests/ObjParser/VertexBufferUnitTests.cpp"
 #include "ObjParserTests/UnitTests/ObjParser/VertexNormalParseUnitTests.cpp"
 #include "ObjParserTests/UnitTests/ObjParser/VertexParseUnitTests.cpp"
 #include "ObjParserTests/UnitTests/ObjParser/VertexTextureParseUnitTests.cpp"
\ No newline at end of file